@@ -148,6 +148,8 @@ bool AppsContainer::dispatchEvent(Ion::Events::Event event) {
       updateBatteryState();
       if (switchTo(usbConnectedAppSnapshot())) {
         Ion::USB::DFU();
+        // The storage may have been written over USB
+        Ion::Storage::sharedStorage()->rebuildRecordIndex();
         // Update LED when exiting DFU mode
         Ion::LED::updateColorWithPlugAndCharge();
         bool switched = switchTo(activeSnapshot);
@@ -12,6 +12,7 @@ HistoryController::HistoryController(EditExpressionController * editExpressionCo
   ViewController(editExpressionController),
   m_selectableTableView(this, this, this, this),
   m_calculationHistory{},
+  m_memoizedExpandedRow(-1),
   m_calculationStore(calculationStore),
   m_complexController(editExpressionController),
   m_integerController(editExpressionController),
@@ -33,6 +34,8 @@ void HistoryController::reload() {
   for (int i = 0; i < k_maxNumberOfDisplayedRows; i++) {
     m_calculationHistory[i].resetMemoization();
   }
+  // Calculations might have been added or deleted
+  m_cumulatedHeights.resetFromIndex(0);
 
   m_selectableTableView.reloadData();
   /* TODO
@@ -212,6 +215,26 @@ KDCoordinate HistoryController::rowHeight(int j) {
   return calculation->height(expanded);
 }
 
+KDCoordinate HistoryController::cumulatedHeightFromIndex(int j) {
+  resetMemoizedRowHeightsIfExpandedRowChanged();
+  return m_cumulatedHeights.cumulatedHeightFromIndex(this, j);
+}
+
+int HistoryController::indexFromCumulatedHeight(KDCoordinate offsetY) {
+  resetMemoizedRowHeightsIfExpandedRowChanged();
+  return m_cumulatedHeights.indexFromCumulatedHeight(this, offsetY);
+}
+
+void HistoryController::resetMemoizedRowHeightsIfExpandedRowChanged() {
+  int expandedRow = selectedSubviewType() == SubviewType::Output ? selectedRow() : -1;
+  if (expandedRow == m_memoizedExpandedRow) {
+    return;
+  }
+  int firstChangedRow = m_memoizedExpandedRow < 0 || (expandedRow >= 0 && expandedRow < m_memoizedExpandedRow) ? expandedRow : m_memoizedExpandedRow;
+  m_cumulatedHeights.resetFromIndex(firstChangedRow);
+  m_memoizedExpandedRow = expandedRow;
+}
+
 int HistoryController::typeAtLocation(int i, int j) {
   return 0;
 }
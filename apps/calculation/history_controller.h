@@ -31,6 +31,8 @@ public:
   int reusableCellCount(int type) override;
   void willDisplayCellForIndex(HighlightCell * cell, int index) override;
   KDCoordinate rowHeight(int j) override;
+  KDCoordinate cumulatedHeightFromIndex(int j) override;
+  int indexFromCumulatedHeight(KDCoordinate offsetY) override;
   int typeAtLocation(int i, int j) override;
   void setSelectedSubviewType(SubviewType subviewType, bool sameCell, int previousSelectedX = -1, int previousSelectedY = -1) override;
   void tableViewDidChangeSelectionAndDidScroll(SelectableTableView * t, int previousSelectedCellX, int previousSelectedCellY, bool withinTemporarySelection = false) override;
@@ -41,8 +43,14 @@ private:
   bool calculationAtIndexToggles(int index);
   void historyViewCellDidChangeSelection(HistoryViewCell ** cell, HistoryViewCell ** previousCell, int previousSelectedCellX, int previousSelectedCellY, SubviewType type, SubviewType previousType) override;
   constexpr static int k_maxNumberOfDisplayedRows = 8;
+  constexpr static int k_maxNumberOfMemoizedRowHeights = 128;
+  void resetMemoizedRowHeightsIfExpandedRowChanged();
   CalculationSelectableTableView m_selectableTableView;
   HistoryViewCell m_calculationHistory[k_maxNumberOfDisplayedRows];
+  /* The height of a row depends on whether its output is expanded, which only
+   * happens for the selected row. */
+  MemoizedCumulatedHeightsWithBuffer<k_maxNumberOfMemoizedRowHeights> m_cumulatedHeights;
+  int m_memoizedExpandedRow;
   CalculationStore * m_calculationStore;
   ComplexListController m_complexController;
   IntegerListController m_integerController;
@@ -83,6 +83,9 @@ void App::Snapshot::setOpt(const char * name, const char * value) {
 App::App(Snapshot * snapshot) :
   Shared::InputEventHandlerDelegateApp(snapshot, &m_codeStackViewController),
   m_pythonHeap{},
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+  m_compiledScriptsCache{},
+#endif
   m_pythonUser(nullptr),
   m_consoleController(nullptr, this, snapshot->scriptStore()
 #if EPSILON_GETOPT
@@ -140,6 +143,9 @@ bool App::textInputDidReceiveEvent(InputEventHandler * textInput, Ion::Events::E
 void App::initPythonWithUser(const void * pythonUser) {
   if (!m_pythonUser) {
     MicroPython::init(m_pythonHeap, m_pythonHeap + k_pythonHeapSize);
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+    MicroPython::registerCompiledScriptsCache(m_compiledScriptsCache, k_compiledScriptsCacheSize);
+#endif
   }
   m_pythonUser = pythonUser;
 }
@@ -147,6 +153,10 @@ void App::initPythonWithUser(const void * pythonUser) {
 void App::deinitPython() {
   if (m_pythonUser) {
     MicroPython::deinit();
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+    // The cache does not outlive the app
+    MicroPython::registerCompiledScriptsCache(nullptr, 0);
+#endif
     m_pythonUser = nullptr;
   }
 }
@@ -76,6 +76,10 @@ public:
   VariableBoxController * variableBoxController() { return &m_variableBoxController; }
 
   static constexpr int k_pythonHeapSize = 99000;
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+  // The compiled code of the imported scripts is cached outside of the heap
+  static constexpr int k_compiledScriptsCacheSize = 4096;
+#endif
 
 private:
   /* Python delegate:
@@ -84,6 +88,9 @@ private:
    * also memoize the last Python user to avoid re-initiating MicroPython when
    * unneeded. */
   char m_pythonHeap[k_pythonHeapSize];
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+  char m_compiledScriptsCache[k_compiledScriptsCacheSize];
+#endif
   const void * m_pythonUser;
 
   App(Snapshot * snapshot);
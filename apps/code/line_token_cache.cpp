@@ -0,0 +1,57 @@
+#include "line_token_cache.h"
+#include <ion.h>
+#include <assert.h>
+
+namespace Code {
+
+void LineTokenCache::clear() {
+  for (int i = 0; i < k_numberOfLines; i++) {
+    m_lines[i].numberOfTokens = k_emptyLine;
+  }
+}
+
+const LineTokenCache::Token * LineTokenCache::tokensOfLine(const char * text, size_t byteLength, int * numberOfTokens) {
+  if (byteLength > k_maxStart) {
+    return nullptr;
+  }
+  uint32_t checksum = Checksum(text, byteLength);
+  for (int i = 0; i < k_numberOfLines; i++) {
+    Line * line = m_lines + i;
+    if (line->numberOfTokens != k_emptyLine && line->byteLength == byteLength && line->checksum == checksum) {
+      line->lastUse = ++m_clock;
+      *numberOfTokens = line->numberOfTokens;
+      return line->tokens;
+    }
+  }
+  return nullptr;
+}
+
+void LineTokenCache::storeTokensOfLine(const char * text, size_t byteLength, const Token * tokens, int numberOfTokens) {
+  if (byteLength > k_maxStart || numberOfTokens > k_maxNumberOfTokensPerLine) {
+    return;
+  }
+  // Replace an empty or the least recently used line
+  Line * line = m_lines;
+  for (int i = 0; i < k_numberOfLines; i++) {
+    if (m_lines[i].numberOfTokens == k_emptyLine) {
+      line = m_lines + i;
+      break;
+    }
+    if (static_cast<uint16_t>(m_clock - m_lines[i].lastUse) > static_cast<uint16_t>(m_clock - line->lastUse)) {
+      line = m_lines + i;
+    }
+  }
+  line->checksum = Checksum(text, byteLength);
+  line->byteLength = byteLength;
+  line->numberOfTokens = numberOfTokens;
+  line->lastUse = ++m_clock;
+  for (int i = 0; i < numberOfTokens; i++) {
+    line->tokens[i] = tokens[i];
+  }
+}
+
+uint32_t LineTokenCache::Checksum(const char * text, size_t byteLength) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t *>(text), byteLength);
+}
+
+}
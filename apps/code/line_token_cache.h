@@ -0,0 +1,64 @@
+#ifndef CODE_LINE_TOKEN_CACHE_H
+#define CODE_LINE_TOKEN_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Code {
+
+/* The syntax highlighting of the editor lexes each drawn line. Lines are
+ * redrawn much more often than they are edited: when the cursor moves or
+ * blinks, when the view scrolls, when the autocompletion changes... The
+ * LineTokenCache keeps the tokens of the last drawn lines, so that only the
+ * lines whose content changed are lexed again.
+ * Lines are lexed independently from each other, so the tokens of a line only
+ * depend on its content. Lines are identified by their length and checksum
+ * rather than by their address: the lines after an edited line move in the
+ * text buffer but keep their tokens. */
+
+class LineTokenCache {
+public:
+  class Token {
+  public:
+    Token(uint16_t start = 0, uint8_t length = 0, uint8_t kind = 0) : m_start(start), m_length(length), m_kind(kind) {}
+    // Byte offset of the token from the beginning of the line
+    uint16_t start() const { return m_start; }
+    uint8_t length() const { return m_length; }
+    // The mp_token_kind_t of the MicroPython lexer
+    uint8_t kind() const { return m_kind; }
+  private:
+    uint16_t m_start;
+    uint8_t m_length;
+    uint8_t m_kind;
+  };
+  constexpr static int k_maxNumberOfTokensPerLine = 24;
+  // Lines with more or longer tokens are not cached
+  constexpr static int k_maxStart = UINT16_MAX;
+  constexpr static int k_maxLength = UINT8_MAX;
+
+  LineTokenCache() : m_clock(0) { clear(); }
+  void clear();
+  // Return the cached tokens of the line, or nullptr if there are none
+  const Token * tokensOfLine(const char * text, size_t byteLength, int * numberOfTokens);
+  void storeTokensOfLine(const char * text, size_t byteLength, const Token * tokens, int numberOfTokens);
+
+private:
+  // About the number of lines displayed by the editor with the small font
+  constexpr static int k_numberOfLines = 14;
+  constexpr static uint8_t k_emptyLine = UINT8_MAX;
+  class Line {
+  public:
+    uint32_t checksum;
+    uint16_t byteLength;
+    uint8_t numberOfTokens; // k_emptyLine if no line is cached
+    uint16_t lastUse;
+    Token tokens[k_maxNumberOfTokensPerLine];
+  };
+  static uint32_t Checksum(const char * text, size_t byteLength);
+  Line m_lines[k_numberOfLines];
+  uint16_t m_clock;
+};
+
+}
+
+#endif
@@ -125,6 +125,8 @@ static inline KDColor TokenColor(mp_token_kind_t tokenKind) {
   return Palette::CodeText;
 }
 
+static_assert(MP_TOKEN_DEL_MINUS_MORE <= UINT8_MAX, "Code::LineTokenCache::Token cannot store the kinds of the MicroPython tokens.");
+
 static inline size_t TokenLength(mp_lexer_t * lex, const char * tokenPosition) {
   /* The lexer stores the beginning of the current token and of the next token,
    * so we just use that. */
@@ -256,70 +258,59 @@ void PythonTextArea::ContentView::drawLine(KDContext * ctx, int line, const char
   }
 
   const char * autocompleteStart = m_autocomplete ? m_cursorLocation : nullptr;
+  const char * tokenEnd = firstNonSpace;
+  bool lineIsDrawn = false;
+
+  int numberOfCachedTokens = 0;
+  const LineTokenCache::Token * cachedTokens = m_tokenCache.tokensOfLine(text, byteLength, &numberOfCachedTokens);
+  if (cachedTokens != nullptr) {
+    for (int i = 0; i < numberOfCachedTokens; i++) {
+      drawToken(ctx, line, text, byteLength, text + cachedTokens[i].start(), cachedTokens[i].length(), cachedTokens[i].kind(), autocompleteStart, selectionStart, selectionEnd, &tokenEnd);
+    }
+    lineIsDrawn = true;
+  } else {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+      mp_lexer_t * lex = mp_lexer_new_from_str_len(0, firstNonSpace, byteLength - (firstNonSpace - text), 0);
+      LOG_DRAW("Pop token %d\n", lex->tok_kind);
 
-  nlr_buf_t nlr;
-  if (nlr_push(&nlr) == 0) {
-    mp_lexer_t * lex = mp_lexer_new_from_str_len(0, firstNonSpace, byteLength - (firstNonSpace - text), 0);
-    LOG_DRAW("Pop token %d\n", lex->tok_kind);
-
-    const char * tokenFrom = firstNonSpace;
-    size_t tokenLength = 0;
-    const char * tokenEnd = firstNonSpace;
-    while (lex->tok_kind != MP_TOKEN_NEWLINE && lex->tok_kind != MP_TOKEN_END) {
-      tokenFrom = firstNonSpace + lex->tok_column - 1;
-      if (tokenFrom != tokenEnd) {
-        // We passed over white spaces, we need to color them
-        drawStringAt(
-            ctx,
-            line,
-            UTF8Helper::GlyphOffsetAtCodePoint(text, tokenEnd),
-            tokenEnd,
-            std::min(text + byteLength, tokenFrom) - tokenEnd,
-            StringColor,
-            BackgroundColor,
-            selectionStart,
-            selectionEnd,
-            HighlightColor);
+      // Keep the tokens to draw the line again without lexing it
+      LineTokenCache::Token tokens[LineTokenCache::k_maxNumberOfTokensPerLine];
+      int numberOfTokens = 0;
+      bool tokensCanBeCached = true;
+      while (lex->tok_kind != MP_TOKEN_NEWLINE && lex->tok_kind != MP_TOKEN_END) {
+        const char * tokenFrom = firstNonSpace + lex->tok_column - 1;
+        size_t tokenLength = TokenLength(lex, tokenFrom);
+        drawToken(ctx, line, text, byteLength, tokenFrom, tokenLength, lex->tok_kind, autocompleteStart, selectionStart, selectionEnd, &tokenEnd);
+        if (numberOfTokens < LineTokenCache::k_maxNumberOfTokensPerLine && tokenLength <= LineTokenCache::k_maxLength) {
+          tokens[numberOfTokens++] = LineTokenCache::Token(tokenFrom - text, tokenLength, lex->tok_kind);
+        } else {
+          tokensCanBeCached = false;
+        }
+        mp_lexer_to_next(lex);
+        LOG_DRAW("Pop token %d\n", lex->tok_kind);
       }
-      tokenLength = TokenLength(lex, tokenFrom);
-      tokenEnd = tokenFrom + tokenLength;
-
-      // If the token is being autocompleted, use DefaultColor
-      KDColor color = (tokenFrom <= autocompleteStart && autocompleteStart < tokenEnd) ? Palette::CodeText : TokenColor(lex->tok_kind);
-
-      LOG_DRAW("Draw \"%.*s\" for token %d\n", tokenLength, tokenFrom, lex->tok_kind);
-      drawStringAt(ctx, line,
-        UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-        tokenFrom,
-        tokenLength,
-        color,
+      if (tokensCanBeCached) {
+        m_tokenCache.storeTokensOfLine(text, byteLength, tokens, numberOfTokens);
+      }
+      mp_lexer_free(lex);
+      nlr_pop();
+      lineIsDrawn = true;
+    }
+  }
+
+  // Even if the token is being autocompleted, use CommentColor
+  if (lineIsDrawn && tokenEnd < text + byteLength) {
+    LOG_DRAW("Draw comment \"%.*s\" from %d\n", byteLength - (tokenEnd - text), firstNonSpace, tokenEnd);
+    drawStringAt(ctx, line,
+        UTF8Helper::GlyphOffsetAtCodePoint(text, tokenEnd),
+        tokenEnd,
+        text + byteLength - tokenEnd,
+        CommentColor,
         BackgroundColor,
         selectionStart,
         selectionEnd,
         HighlightColor);
-
-      mp_lexer_to_next(lex);
-      LOG_DRAW("Pop token %d\n", lex->tok_kind);
-    }
-
-    tokenFrom += tokenLength;
-
-    // Even if the token is being autocompleted, use CommentColor
-    if (tokenFrom < text + byteLength) {
-      LOG_DRAW("Draw comment \"%.*s\" from %d\n", byteLength - (tokenFrom - text), firstNonSpace, tokenFrom);
-      drawStringAt(ctx, line,
-          UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
-          tokenFrom,
-          text + byteLength - tokenFrom,
-          CommentColor,
-          BackgroundColor,
-          selectionStart,
-          selectionEnd,
-          HighlightColor);
-    }
-
-    mp_lexer_free(lex);
-    nlr_pop();
   }
 
   // Redraw the autocompleted word in the right color
@@ -339,6 +330,39 @@ void PythonTextArea::ContentView::drawLine(KDContext * ctx, int line, const char
   }
 }
 
+void PythonTextArea::ContentView::drawToken(KDContext * ctx, int line, const char * text, size_t byteLength, const char * tokenFrom, size_t tokenLength, uint8_t tokenKind, const char * autocompleteStart, const char * selectionStart, const char * selectionEnd, const char * * previousTokenEnd) const {
+  if (tokenFrom != *previousTokenEnd) {
+    // We passed over white spaces, we need to color them
+    drawStringAt(
+        ctx,
+        line,
+        UTF8Helper::GlyphOffsetAtCodePoint(text, *previousTokenEnd),
+        *previousTokenEnd,
+        std::min(text + byteLength, tokenFrom) - *previousTokenEnd,
+        StringColor,
+        BackgroundColor,
+        selectionStart,
+        selectionEnd,
+        HighlightColor);
+  }
+  const char * tokenEnd = tokenFrom + tokenLength;
+
+  // If the token is being autocompleted, use DefaultColor
+  KDColor color = (tokenFrom <= autocompleteStart && autocompleteStart < tokenEnd) ? Palette::CodeText : TokenColor(static_cast<mp_token_kind_t>(tokenKind));
+
+  LOG_DRAW("Draw \"%.*s\" for token %d\n", tokenLength, tokenFrom, tokenKind);
+  drawStringAt(ctx, line,
+    UTF8Helper::GlyphOffsetAtCodePoint(text, tokenFrom),
+    tokenFrom,
+    tokenLength,
+    color,
+    BackgroundColor,
+    selectionStart,
+    selectionEnd,
+    HighlightColor);
+  *previousTokenEnd = tokenEnd;
+}
+
 KDRect PythonTextArea::ContentView::dirtyRectFromPosition(const char * position, bool includeFollowingLines) const {
   /* Mark the whole line as dirty.
    * TextArea has a very conservative approach and only dirties the surroundings
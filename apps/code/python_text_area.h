@@ -2,6 +2,7 @@
 #define CODE_PYTHON_TEXT_AREA_H
 
 #include <escher/text_area.h>
+#include "line_token_cache.h"
 
 namespace Code {
 
@@ -55,9 +56,11 @@ protected:
     void drawLine(KDContext * ctx, int line, const char * text, size_t length, int fromColumn, int toColumn, const char * selectionStart, const char * selectionEnd) const override;
     KDRect dirtyRectFromPosition(const char * position, bool includeFollowingLines) const override;
   private:
+    void drawToken(KDContext * ctx, int line, const char * text, size_t byteLength, const char * tokenFrom, size_t tokenLength, uint8_t tokenKind, const char * autocompleteStart, const char * selectionStart, const char * selectionEnd, const char * * previousTokenEnd) const;
     App * m_pythonDelegate;
     bool m_autocomplete;
     const char * m_autocompletionEnd;
+    mutable LineTokenCache m_tokenCache;
   };
 private:
   void removeAutocompletion();
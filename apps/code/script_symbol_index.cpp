@@ -0,0 +1,87 @@
+#include "script_symbol_index.h"
+#include <ion.h>
+#include <assert.h>
+#include <string.h>
+
+namespace Code {
+
+qstr ScriptSymbolIndex::Symbol::name(const char * scriptContent) const {
+  if (m_nameIsQstr) {
+    return m_name;
+  }
+  return qstr_from_strn(scriptContent + m_name, m_nameLength);
+}
+
+void ScriptSymbolIndex::Builder::addSymbol(Symbol::Type type, qstr name) {
+  if (m_numberOfSymbols >= k_maxNumberOfSymbolsPerScript) {
+    m_isComplete = false;
+    return;
+  }
+  if (name < MP_QSTRnumber_of) {
+    // Builtin qstrs are not freed with the MicroPython heap
+    m_symbols[m_numberOfSymbols++] = Symbol(type, name, 0, true);
+    return;
+  }
+  /* The name was read from the script: any occurrence of it in the content
+   * will do. */
+  const char * nameInContent = strstr(m_scriptContent, qstr_str(name));
+  size_t nameLength = qstr_len(name);
+  if (nameInContent == nullptr || nameInContent - m_scriptContent > UINT16_MAX || nameLength > UINT8_MAX) {
+    m_isComplete = false;
+    return;
+  }
+  m_symbols[m_numberOfSymbols++] = Symbol(type, nameInContent - m_scriptContent, nameLength);
+}
+
+void ScriptSymbolIndex::clear() {
+  for (int i = 0; i < k_numberOfScripts; i++) {
+    m_scripts[i].numberOfSymbols = k_emptyScript;
+  }
+}
+
+const ScriptSymbolIndex::Symbol * ScriptSymbolIndex::symbolsOfScript(const char * scriptContent, size_t byteLength, int * numberOfSymbols) {
+  if (byteLength > UINT16_MAX) {
+    return nullptr;
+  }
+  uint32_t checksum = Checksum(scriptContent, byteLength);
+  for (int i = 0; i < k_numberOfScripts; i++) {
+    Script * script = m_scripts + i;
+    if (script->numberOfSymbols != k_emptyScript && script->byteLength == byteLength && script->checksum == checksum) {
+      script->lastUse = ++m_clock;
+      *numberOfSymbols = script->numberOfSymbols;
+      return script->symbols;
+    }
+  }
+  return nullptr;
+}
+
+void ScriptSymbolIndex::storeSymbolsOfScript(const char * scriptContent, size_t byteLength, const Builder * builder) {
+  assert(builder->numberOfSymbols() <= k_maxNumberOfSymbolsPerScript);
+  if (byteLength > UINT16_MAX || !builder->isComplete()) {
+    return;
+  }
+  // Replace an empty or the least recently used script
+  Script * script = m_scripts;
+  for (int i = 0; i < k_numberOfScripts; i++) {
+    if (m_scripts[i].numberOfSymbols == k_emptyScript) {
+      script = m_scripts + i;
+      break;
+    }
+    if (static_cast<uint16_t>(m_clock - m_scripts[i].lastUse) > static_cast<uint16_t>(m_clock - script->lastUse)) {
+      script = m_scripts + i;
+    }
+  }
+  script->checksum = Checksum(scriptContent, byteLength);
+  script->byteLength = byteLength;
+  script->numberOfSymbols = builder->numberOfSymbols();
+  script->lastUse = ++m_clock;
+  for (int i = 0; i < builder->numberOfSymbols(); i++) {
+    script->symbols[i] = builder->symbols()[i];
+  }
+}
+
+uint32_t ScriptSymbolIndex::Checksum(const char * scriptContent, size_t byteLength) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t *>(scriptContent), byteLength);
+}
+
+}
@@ -0,0 +1,91 @@
+#ifndef CODE_SCRIPT_SYMBOL_INDEX_H
+#define CODE_SCRIPT_SYMBOL_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+extern "C" {
+#include "py/qstr.h"
+}
+
+namespace Code {
+
+/* The variable box and the autocompletion load the functions, variables and
+ * imports defined at the top level of the scripts imported by the edited
+ * script. Parsing these scripts again at each keypress is slow, whereas they
+ * rarely change while another script is edited. The ScriptSymbolIndex keeps
+ * the top level symbols of the last parsed scripts, so that a script is only
+ * parsed again when its content changes.
+ * Scripts are identified by the length and checksum of their content. Symbol
+ * names are stored as offsets in the content, or as builtin qstrs, so that
+ * the index survives the reset of the MicroPython heap and does not depend on
+ * where the script record lies in the storage. */
+
+class ScriptSymbolIndex {
+public:
+  class Symbol {
+  public:
+    enum class Type : uint8_t {
+      Function,
+      Variable,
+      ImportedName, // "sin" in "from math import sin"
+      ImportedSource // "math" in "from math import *"
+    };
+    Symbol(Type type = Type::Variable, uint16_t name = 0, uint8_t nameLength = 0, bool nameIsQstr = false) :
+      m_name(name),
+      m_nameLength(nameLength),
+      m_type(static_cast<uint8_t>(type)),
+      m_nameIsQstr(nameIsQstr)
+    {}
+    Type type() const { return static_cast<Type>(m_type); }
+    // Intern the name, which requires the MicroPython heap
+    qstr name(const char * scriptContent) const;
+  private:
+    uint16_t m_name; // Offset in the script content, or builtin qstr
+    uint8_t m_nameLength;
+    uint8_t m_type : 7;
+    uint8_t m_nameIsQstr : 1;
+  };
+  constexpr static int k_maxNumberOfSymbolsPerScript = 32;
+
+  /* A Builder records the symbols of a script while it is parsed. It is
+   * incomplete if a symbol cannot be stored, in which case the script is not
+   * indexed. */
+  class Builder {
+  public:
+    Builder(const char * scriptContent) : m_scriptContent(scriptContent), m_numberOfSymbols(0), m_isComplete(true) {}
+    void addSymbol(Symbol::Type type, qstr name);
+    bool isComplete() const { return m_isComplete; }
+    const Symbol * symbols() const { return m_symbols; }
+    int numberOfSymbols() const { return m_numberOfSymbols; }
+  private:
+    const char * m_scriptContent;
+    Symbol m_symbols[k_maxNumberOfSymbolsPerScript];
+    int m_numberOfSymbols;
+    bool m_isComplete;
+  };
+
+  ScriptSymbolIndex() : m_clock(0) { clear(); }
+  void clear();
+  // Return the indexed symbols of the script, or nullptr if there are none
+  const Symbol * symbolsOfScript(const char * scriptContent, size_t byteLength, int * numberOfSymbols);
+  void storeSymbolsOfScript(const char * scriptContent, size_t byteLength, const Builder * builder);
+
+private:
+  constexpr static int k_numberOfScripts = 8;
+  constexpr static uint8_t k_emptyScript = UINT8_MAX;
+  class Script {
+  public:
+    uint32_t checksum;
+    uint16_t byteLength;
+    uint8_t numberOfSymbols; // k_emptyScript if no script is indexed
+    uint16_t lastUse;
+    Symbol symbols[k_maxNumberOfSymbolsPerScript];
+  };
+  static uint32_t Checksum(const char * scriptContent, size_t byteLength);
+  Script m_scripts[k_numberOfScripts];
+  uint16_t m_clock;
+};
+
+}
+
+#endif
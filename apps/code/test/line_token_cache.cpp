@@ -0,0 +1,60 @@
+#include <quiz.h>
+#include "../line_token_cache.h"
+#include <stdio.h>
+#include <string.h>
+
+using namespace Code;
+
+static void store_line(LineTokenCache * cache, const char * line, int numberOfTokens) {
+  LineTokenCache::Token tokens[LineTokenCache::k_maxNumberOfTokensPerLine + 1];
+  for (int i = 0; i < numberOfTokens; i++) {
+    tokens[i] = LineTokenCache::Token(i, 1, i);
+  }
+  cache->storeTokensOfLine(line, strlen(line), tokens, numberOfTokens);
+}
+
+static bool line_is_cached(LineTokenCache * cache, const char * line, int expectedNumberOfTokens = -1) {
+  int numberOfTokens = -1;
+  const LineTokenCache::Token * tokens = cache->tokensOfLine(line, strlen(line), &numberOfTokens);
+  if (tokens == nullptr) {
+    return false;
+  }
+  if (expectedNumberOfTokens >= 0) {
+    quiz_assert(numberOfTokens == expectedNumberOfTokens);
+    for (int i = 0; i < numberOfTokens; i++) {
+      quiz_assert(tokens[i].start() == i && tokens[i].length() == 1 && tokens[i].kind() == i);
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(code_line_token_cache) {
+  LineTokenCache cache;
+  quiz_assert(!line_is_cached(&cache, "def f(x):"));
+  store_line(&cache, "def f(x):", 6);
+  quiz_assert(line_is_cached(&cache, "def f(x):", 6));
+
+  // Lines are identified by their content, not by their address
+  char buffer[] = "  def f(x):";
+  quiz_assert(line_is_cached(&cache, buffer + 2, 6));
+  buffer[6] = 'g';
+  quiz_assert(!line_is_cached(&cache, buffer + 2));
+  quiz_assert(!line_is_cached(&cache, "def f(x)"));
+
+  // Lines with too many tokens are not cached
+  store_line(&cache, "a+b+c+d+e+f+g+h+i+j+k+l+m", LineTokenCache::k_maxNumberOfTokensPerLine + 1);
+  quiz_assert(!line_is_cached(&cache, "a+b+c+d+e+f+g+h+i+j+k+l+m"));
+
+  // The least recently used lines are replaced
+  cache.clear();
+  constexpr int numberOfLines = 40;
+  char lines[numberOfLines][8];
+  for (int i = 0; i < numberOfLines; i++) {
+    snprintf(lines[i], sizeof(lines[i]), "x = %d", i);
+    store_line(&cache, lines[i], i % 4);
+    // The first line is drawn again and again, like the line of the cursor
+    quiz_assert(line_is_cached(&cache, lines[0], 0));
+  }
+  quiz_assert(line_is_cached(&cache, lines[numberOfLines - 1], (numberOfLines - 1) % 4));
+  quiz_assert(!line_is_cached(&cache, lines[1]));
+}
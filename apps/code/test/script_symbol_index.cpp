@@ -0,0 +1,81 @@
+#include <quiz.h>
+#include "../script_symbol_index.h"
+#include <python/port/port.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace Code;
+
+static char s_pythonHeap[4096];
+
+static void store_script(ScriptSymbolIndex * index, const char * content, int numberOfSymbols) {
+  ScriptSymbolIndex::Builder builder(content);
+  for (int i = 0; i < numberOfSymbols; i++) {
+    builder.addSymbol(ScriptSymbolIndex::Symbol::Type::Variable, MP_QSTR_math);
+  }
+  index->storeSymbolsOfScript(content, strlen(content), &builder);
+}
+
+static bool script_is_indexed(ScriptSymbolIndex * index, const char * content) {
+  int numberOfSymbols = 0;
+  return index->symbolsOfScript(content, strlen(content), &numberOfSymbols) != nullptr;
+}
+
+QUIZ_CASE(code_script_symbol_index) {
+  MicroPython::init(s_pythonHeap, s_pythonHeap + sizeof(s_pythonHeap));
+  const char * script = "from math import *\nimport turtle\ndef triple(x):\n  return 3*x\nlength = 3\n";
+  ScriptSymbolIndex index;
+  quiz_assert(!script_is_indexed(&index, script));
+
+  ScriptSymbolIndex::Builder builder(script);
+  builder.addSymbol(ScriptSymbolIndex::Symbol::Type::ImportedSource, MP_QSTR_math);
+  builder.addSymbol(ScriptSymbolIndex::Symbol::Type::ImportedName, MP_QSTR_turtle);
+  builder.addSymbol(ScriptSymbolIndex::Symbol::Type::Function, qstr_from_str("triple"));
+  builder.addSymbol(ScriptSymbolIndex::Symbol::Type::Variable, qstr_from_str("length"));
+  quiz_assert(builder.isComplete());
+  index.storeSymbolsOfScript(script, strlen(script), &builder);
+
+  // The index survives the reset of the MicroPython heap
+  MicroPython::deinit();
+  MicroPython::init(s_pythonHeap, s_pythonHeap + sizeof(s_pythonHeap));
+
+  // Scripts are identified by their content, not by their address
+  char buffer[100];
+  strlcpy(buffer, script, sizeof(buffer));
+  int numberOfSymbols = 0;
+  const ScriptSymbolIndex::Symbol * symbols = index.symbolsOfScript(buffer, strlen(buffer), &numberOfSymbols);
+  quiz_assert(symbols != nullptr && numberOfSymbols == 4);
+  quiz_assert(symbols[0].type() == ScriptSymbolIndex::Symbol::Type::ImportedSource && symbols[0].name(buffer) == MP_QSTR_math);
+  quiz_assert(symbols[1].type() == ScriptSymbolIndex::Symbol::Type::ImportedName && symbols[1].name(buffer) == MP_QSTR_turtle);
+  quiz_assert(symbols[2].type() == ScriptSymbolIndex::Symbol::Type::Function && strcmp(qstr_str(symbols[2].name(buffer)), "triple") == 0);
+  quiz_assert(symbols[3].type() == ScriptSymbolIndex::Symbol::Type::Variable && strcmp(qstr_str(symbols[3].name(buffer)), "length") == 0);
+
+  // Edited scripts are parsed again
+  buffer[strlen(buffer) - 2] = '4';
+  quiz_assert(!script_is_indexed(&index, buffer));
+
+  // Scripts with unlocated or too many symbols are not indexed
+  ScriptSymbolIndex::Builder incompleteBuilder(script);
+  incompleteBuilder.addSymbol(ScriptSymbolIndex::Symbol::Type::Variable, qstr_from_str("unlocated_name"));
+  quiz_assert(!incompleteBuilder.isComplete());
+  const char * longScript = "x = 1\n";
+  index.clear();
+  store_script(&index, longScript, ScriptSymbolIndex::k_maxNumberOfSymbolsPerScript + 1);
+  quiz_assert(!script_is_indexed(&index, longScript));
+  store_script(&index, longScript, ScriptSymbolIndex::k_maxNumberOfSymbolsPerScript);
+  quiz_assert(script_is_indexed(&index, longScript));
+
+  // The least recently used scripts are replaced
+  index.clear();
+  constexpr int numberOfScripts = 20;
+  char scripts[numberOfScripts][8];
+  for (int i = 0; i < numberOfScripts; i++) {
+    snprintf(scripts[i], sizeof(scripts[i]), "x = %d", i);
+    store_script(&index, scripts[i], 1);
+    // The first script is imported again and again
+    quiz_assert(script_is_indexed(&index, scripts[0]));
+  }
+  quiz_assert(script_is_indexed(&index, scripts[numberOfScripts - 1]));
+  quiz_assert(!script_is_indexed(&index, scripts[1]));
+  MicroPython::deinit();
+}
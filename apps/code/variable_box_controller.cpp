@@ -633,11 +633,33 @@ void VariableBoxController::loadGlobalAndImportedVariablesInScriptAsImported(Scr
     // We already fetched these script variables
     return;
   }
+  /* Mark that we already fetched these script variables, before fetching the
+   * scripts it imports in case they import it too. */
+  script.setFetchedForVariableBox(true);
+  const char * scriptName = script.fullName();
+  const char * scriptContent = script.content();
+  size_t scriptContentLength = strlen(scriptContent);
+
+  // Read the symbols of the script from the index if it did not change
+  int numberOfSymbols = 0;
+  const ScriptSymbolIndex::Symbol * symbols = m_symbolIndex.symbolsOfScript(scriptContent, scriptContentLength, &numberOfSymbols);
+  if (symbols != nullptr) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+      for (int i = 0; i < numberOfSymbols; i++) {
+        if (loadSymbol(symbols[i].type(), symbols[i].name(scriptContent), scriptName, textToAutocomplete, textToAutocompleteLength, importFromModules)) {
+          break;
+        }
+      }
+      nlr_pop();
+    }
+    return;
+  }
+
+  ScriptSymbolIndex::Builder symbolsBuilder(scriptContent);
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
-    const char * scriptName = script.fullName();
-    const char * scriptContent = script.content();
-    mp_lexer_t *lex = mp_lexer_new_from_str_len(0, scriptContent, strlen(scriptContent), false);
+    mp_lexer_t *lex = mp_lexer_new_from_str_len(0, scriptContent, scriptContentLength, false);
     mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
     mp_parse_node_t pn = parseTree.root;
 
@@ -646,8 +668,8 @@ void VariableBoxController::loadGlobalAndImportedVariablesInScriptAsImported(Scr
       uint structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(pns);
       if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
         // The script is only a single function or variable definition
-        addImportStructFromScript(pns, structKind, scriptName, textToAutocomplete, textToAutocompleteLength);
-      } else if (addNodesFromImportMaybe(pns, textToAutocomplete, textToAutocompleteLength, importFromModules)) {
+        addImportStructFromScript(pns, structKind, scriptName, textToAutocomplete, textToAutocompleteLength, &symbolsBuilder);
+      } else if (addNodesFromImportMaybe(pns, textToAutocomplete, textToAutocompleteLength, importFromModules, &symbolsBuilder)) {
         // The script is is only an import, handled in addNodesFromImportMaybe
       } else if (structKind == PN_file_input_2) {
         /* At this point, if the script node is not of type "file_input_2", it
@@ -661,11 +683,9 @@ void VariableBoxController::loadGlobalAndImportedVariablesInScriptAsImported(Scr
             mp_parse_node_struct_t *child_pns = (mp_parse_node_struct_t*)(child);
             structKind = (uint)MP_PARSE_NODE_STRUCT_KIND(child_pns);
             if (structKind == PN_funcdef || structKind == PN_expr_stmt) {
-              if (addImportStructFromScript(child_pns, structKind, scriptName, textToAutocomplete, textToAutocompleteLength)) {
-                break;
-              }
+              addImportStructFromScript(child_pns, structKind, scriptName, textToAutocomplete, textToAutocompleteLength, &symbolsBuilder);
             } else {
-              addNodesFromImportMaybe(child_pns, textToAutocomplete, textToAutocompleteLength, importFromModules);
+              addNodesFromImportMaybe(child_pns, textToAutocomplete, textToAutocompleteLength, importFromModules, &symbolsBuilder);
             }
           }
         }
@@ -673,12 +693,12 @@ void VariableBoxController::loadGlobalAndImportedVariablesInScriptAsImported(Scr
     }
     mp_parse_tree_clear(&parseTree);
     nlr_pop();
+    // Only index the scripts that could be parsed entirely
+    m_symbolIndex.storeSymbolsOfScript(scriptContent, scriptContentLength, &symbolsBuilder);
   }
-  // Mark that we already fetched these script variables
-  script.setFetchedForVariableBox(true);
 }
 
-bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * parseNode, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules) {
+bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * parseNode, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules, ScriptSymbolIndex::Builder * symbolsBuilder) {
   // Determine if the node is an import structure
   uint structKind = (uint) MP_PARSE_NODE_STRUCT_KIND(parseNode);
   bool structKindIsImportWithoutFrom = structKind == PN_import_name;
@@ -701,37 +721,12 @@ bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * par
     mp_parse_node_t child = parseNode->nodes[i];
     if (MP_PARSE_NODE_IS_LEAF(child) && MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID) {
       // Parsing something like "import xyz"
-      const char * id = qstr_str(MP_PARSE_NODE_LEAF_ARG(child));
-
-      /* xyz might be:
-       *  - a module name -> in which case we want no importation source on the
-       *    node. The node will not be added if it is already in the builtins.
-       *  - a script name -> we want to have xyz.py as the importation source
-       *  - a non-existing identifier -> we want no source */
-      const char * sourceId = nullptr;
-      if (importationSourceIsModule(id)) {
-        if (!importFromModules) {
-          return true;
-        }
-      } else {
-        /*  If a module and a script have the same name, the micropython
-         *  importation algorithm first looks for a module then for a script. We
-         *  should thus check that the id is not a module name before retreiving
-         *  a script name to put it as source. */
-        if (!importationSourceIsScript(id, &sourceId) && !importFromModules) { // Warning : must be done in this order
-          /* We call importationSourceIsScript to load the script name in
-           * sourceId. We also use it to make sure, if importFromModules is
-           * false, that we are not importing variables from something else than
-           * scripts. */
-          return true;
-        }
-      }
-      if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, ScriptNode::Type::WithoutParentheses, NodeOrigin::Importation, id, -1, sourceId)) {
+      if (loadSymbol(ScriptSymbolIndex::Symbol::Type::ImportedName, MP_PARSE_NODE_LEAF_ARG(child), nullptr, textToAutocomplete, textToAutocompleteLength, importFromModules, symbolsBuilder)) {
         break;
       }
     } else if (MP_PARSE_NODE_IS_STRUCT(child)) {
       // Parsing something like "from math import sin"
-      addNodesFromImportMaybe((mp_parse_node_struct_t *)child, textToAutocomplete, textToAutocompleteLength, importFromModules);
+      addNodesFromImportMaybe((mp_parse_node_struct_t *)child, textToAutocomplete, textToAutocompleteLength, importFromModules, symbolsBuilder);
     } else if (MP_PARSE_NODE_IS_TOKEN(child) && MP_PARSE_NODE_IS_TOKEN_KIND(child, MP_TOKEN_OP_STAR)) {
       /* Parsing something like "from math import *"
        * -> Load all the module content */
@@ -742,55 +737,108 @@ bool VariableBoxController::addNodesFromImportMaybe(mp_parse_node_struct_t * par
   // Fetch a script / module content if needed
   if (loadAllSourceContent) {
     assert(childNodesCount > 0);
-    const char * importationSourceName = importationSourceNameFromNode(parseNode->nodes[0]);
-    if (importationSourceName == nullptr) {
+    qstr importationSourceName = importationSourceNameFromNode(parseNode->nodes[0]);
+    if (importationSourceName == MP_QSTRnull) {
       // For instance, the name is a "dotted name" but not matplotlib.pyplot
       return true;
     }
-    int numberOfModuleChildren = 0;
-    const ToolboxMessageTree * moduleChildren = nullptr;
-    if (importationSourceIsModule(importationSourceName, &moduleChildren, &numberOfModuleChildren)) {
-      if (!importFromModules) {
-        return true;
-      }
-      if (moduleChildren != nullptr) {
-        /* The importation source is a module that we display in the toolbox:
-         * get the nodes from the toolbox
-         * We skip the 3 first nodes, which are "import ...", "from ... import *"
-         * and "....function". */
-        constexpr int numberOfNodesToSkip = 3;
-        assert(numberOfModuleChildren > numberOfNodesToSkip);
-        for (int i = numberOfNodesToSkip; i < numberOfModuleChildren; i++) {
-          const char * name = I18n::translate((moduleChildren + i)->label());
-          if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, ScriptNode::Type::WithoutParentheses, NodeOrigin::Importation, name, -1, importationSourceName, I18n::translate((moduleChildren + i)->text()))) {
-            break;
-          }
+    loadSymbol(ScriptSymbolIndex::Symbol::Type::ImportedSource, importationSourceName, nullptr, textToAutocomplete, textToAutocompleteLength, importFromModules, symbolsBuilder);
+  }
+  return true;
+}
+
+bool VariableBoxController::loadSymbol(ScriptSymbolIndex::Symbol::Type type, qstr name, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules, ScriptSymbolIndex::Builder * symbolsBuilder) {
+  bool escape = false;
+  switch (type) {
+    case ScriptSymbolIndex::Symbol::Type::Function:
+    case ScriptSymbolIndex::Symbol::Type::Variable:
+      escape = addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, type == ScriptSymbolIndex::Symbol::Type::Function ? ScriptNode::Type::WithParentheses : ScriptNode::Type::WithoutParentheses, NodeOrigin::Importation, qstr_str(name), -1, scriptName);
+      break;
+    case ScriptSymbolIndex::Symbol::Type::ImportedName:
+      escape = loadImportedName(qstr_str(name), textToAutocomplete, textToAutocompleteLength, importFromModules);
+      break;
+    default:
+      assert(type == ScriptSymbolIndex::Symbol::Type::ImportedSource);
+      loadImportedSource(qstr_str(name), textToAutocomplete, textToAutocompleteLength, importFromModules);
+  }
+  if (symbolsBuilder != nullptr) {
+    // Keep scanning to index all the symbols of the script
+    symbolsBuilder->addSymbol(type, name);
+    return false;
+  }
+  return escape;
+}
+
+bool VariableBoxController::loadImportedName(const char * name, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules) {
+  /* name might be:
+   *  - a module name -> in which case we want no importation source on the
+   *    node. The node will not be added if it is already in the builtins.
+   *  - a script name -> we want to have name.py as the importation source
+   *  - a non-existing identifier -> we want no source */
+  const char * sourceId = nullptr;
+  if (importationSourceIsModule(name)) {
+    if (!importFromModules) {
+      return false;
+    }
+  } else {
+    /*  If a module and a script have the same name, the micropython
+     *  importation algorithm first looks for a module then for a script. We
+     *  should thus check that the id is not a module name before retreiving
+     *  a script name to put it as source. */
+    if (!importationSourceIsScript(name, &sourceId) && !importFromModules) { // Warning : must be done in this order
+      /* We call importationSourceIsScript to load the script name in
+       * sourceId. We also use it to make sure, if importFromModules is
+       * false, that we are not importing variables from something else than
+       * scripts. */
+      return false;
+    }
+  }
+  return addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, ScriptNode::Type::WithoutParentheses, NodeOrigin::Importation, name, -1, sourceId);
+}
+
+void VariableBoxController::loadImportedSource(const char * sourceName, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules) {
+  int numberOfModuleChildren = 0;
+  const ToolboxMessageTree * moduleChildren = nullptr;
+  if (importationSourceIsModule(sourceName, &moduleChildren, &numberOfModuleChildren)) {
+    if (!importFromModules) {
+      return;
+    }
+    if (moduleChildren != nullptr) {
+      /* The importation source is a module that we display in the toolbox:
+       * get the nodes from the toolbox
+       * We skip the 3 first nodes, which are "import ...", "from ... import *"
+       * and "....function". */
+      constexpr int numberOfNodesToSkip = 3;
+      assert(numberOfModuleChildren > numberOfNodesToSkip);
+      for (int i = numberOfNodesToSkip; i < numberOfModuleChildren; i++) {
+        const char * name = I18n::translate((moduleChildren + i)->label());
+        if (addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, ScriptNode::Type::WithoutParentheses, NodeOrigin::Importation, name, -1, sourceName, I18n::translate((moduleChildren + i)->text()))) {
+          break;
         }
-      } else {
-        //TODO get module variables that are not in the toolbox
       }
     } else {
-      // Try fetching the nodes from a script
-      Script importedScript;
-      const char * scriptFullName;
-      if (importationSourceIsScript(importationSourceName, &scriptFullName, &importedScript)) {
-        loadGlobalAndImportedVariablesInScriptAsImported(importedScript, textToAutocomplete, textToAutocompleteLength);
-      }
+      //TODO get module variables that are not in the toolbox
+    }
+  } else {
+    // Try fetching the nodes from a script
+    Script importedScript;
+    const char * scriptFullName;
+    if (importationSourceIsScript(sourceName, &scriptFullName, &importedScript)) {
+      loadGlobalAndImportedVariablesInScriptAsImported(importedScript, textToAutocomplete, textToAutocompleteLength);
     }
   }
-  return true;
 }
 
-const char * VariableBoxController::importationSourceNameFromNode(mp_parse_node_t & node) {
+qstr VariableBoxController::importationSourceNameFromNode(mp_parse_node_t & node) {
   if (MP_PARSE_NODE_IS_LEAF(node) && MP_PARSE_NODE_LEAF_KIND(node) == MP_PARSE_NODE_ID) {
     // The importation source is "simple", for instance: from math import *
-    return qstr_str(MP_PARSE_NODE_LEAF_ARG(node));
+    return MP_PARSE_NODE_LEAF_ARG(node);
   }
   if (MP_PARSE_NODE_IS_STRUCT(node)) { //TODO replace this with an assert?
     mp_parse_node_struct_t * nodePNS = (mp_parse_node_struct_t *)node;
     uint nodeStructKind = MP_PARSE_NODE_STRUCT_KIND(nodePNS);
     if (nodeStructKind != PN_dotted_name) {
-      return nullptr;
+      return MP_QSTRnull;
     }
     /* The importation source is "complex", for instance:
      * from matplotlib.pyplot import *
@@ -801,17 +849,15 @@ const char * VariableBoxController::importationSourceNameFromNode(mp_parse_node_
      * find is matplolib.pyplot, so we do a very specific search. */
     int numberOfSplitNames = MP_PARSE_NODE_STRUCT_NUM_NODES(nodePNS);
     if (numberOfSplitNames != 2) {
-      return nullptr;
+      return MP_QSTRnull;
     }
-    const char * nodeSubName = qstr_str(MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[0]));
-    if (strcmp(nodeSubName, qstr_str(MP_QSTR_matplotlib)) == 0) {
-      nodeSubName = qstr_str(MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[1]));
-      if (strcmp(nodeSubName, qstr_str(MP_QSTR_pyplot)) == 0) {
-        return qstr_str(MP_QSTR_matplotlib_dot_pyplot);
-      }
+    if (MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[0]) == MP_QSTR_matplotlib
+        && MP_PARSE_NODE_LEAF_ARG(nodePNS->nodes[1]) == MP_QSTR_pyplot)
+    {
+      return MP_QSTR_matplotlib_dot_pyplot;
     }
   }
-  return nullptr;
+  return MP_QSTRnull;
 }
 
 bool VariableBoxController::importationSourceIsModule(const char * sourceName, const ToolboxMessageTree * * moduleChildren, int * numberOfModuleChildren) {
@@ -839,30 +885,29 @@ bool VariableBoxController::importationSourceIsScript(const char * sourceName, c
    return true;
 }
 
-const char * structName(mp_parse_node_struct_t * structNode) {
+qstr structName(mp_parse_node_struct_t * structNode) {
   // Find the id child node, which stores the struct's name
   size_t childNodesCount = MP_PARSE_NODE_STRUCT_NUM_NODES(structNode);
   if (childNodesCount < 1) {
-    return nullptr;
+    return MP_QSTRnull;
   }
   mp_parse_node_t child = structNode->nodes[0];
   if (MP_PARSE_NODE_IS_LEAF(child)
       && MP_PARSE_NODE_LEAF_KIND(child) == MP_PARSE_NODE_ID)
   {
-    uintptr_t arg = MP_PARSE_NODE_LEAF_ARG(child);
-    return qstr_str(arg);
+    return MP_PARSE_NODE_LEAF_ARG(child);
   }
-  return nullptr;
+  return MP_QSTRnull;
 }
 
-bool VariableBoxController::addImportStructFromScript(mp_parse_node_struct_t * pns, uint structKind, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength) {
+bool VariableBoxController::addImportStructFromScript(mp_parse_node_struct_t * pns, uint structKind, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength, ScriptSymbolIndex::Builder * symbolsBuilder) {
   assert(structKind == PN_funcdef || structKind == PN_expr_stmt);
   // Find the id child node, which stores the struct's name
-  const char * name = structName(pns);
-  if (name == nullptr) {
+  qstr name = structName(pns);
+  if (name == MP_QSTRnull) {
     return false;
   }
-  return addNodeIfMatches(textToAutocomplete, textToAutocompleteLength, structKind == PN_funcdef ? ScriptNode::Type::WithParentheses : ScriptNode::Type::WithoutParentheses, NodeOrigin::Importation, name, -1, scriptName);
+  return loadSymbol(structKind == PN_funcdef ? ScriptSymbolIndex::Symbol::Type::Function : ScriptSymbolIndex::Symbol::Type::Variable, name, scriptName, textToAutocomplete, textToAutocompleteLength, true, symbolsBuilder);
 }
 
 // The returned boolean means we should escape the process
@@ -7,6 +7,7 @@
 #include "script_node.h"
 #include "script_node_cell.h"
 #include "script_store.h"
+#include "script_symbol_index.h"
 #include "variable_box_empty_controller.h"
 
 namespace Code {
@@ -89,11 +90,17 @@ private:
   void loadCurrentVariablesInScript(const char * scriptContent, const char * textToAutocomplete, int textToAutocompleteLength);
   void loadGlobalAndImportedVariablesInScriptAsImported(Script script, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules = true);
   // Returns true if this was an import structure
-  bool addNodesFromImportMaybe(mp_parse_node_struct_t * parseNode, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules = true);
-  const char * importationSourceNameFromNode(mp_parse_node_t & node);
+  bool addNodesFromImportMaybe(mp_parse_node_struct_t * parseNode, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules = true, ScriptSymbolIndex::Builder * symbolsBuilder = nullptr);
+  qstr importationSourceNameFromNode(mp_parse_node_t & node);
   bool importationSourceIsModule(const char * sourceName, const ToolboxMessageTree * * moduleChildren = nullptr, int * numberOfModuleChildren = nullptr);
   bool importationSourceIsScript(const char * sourceName, const char * * scriptFullName, Script * retreivedScript = nullptr);
-  bool addImportStructFromScript(mp_parse_node_struct_t * pns, uint structKind, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength);
+  bool addImportStructFromScript(mp_parse_node_struct_t * pns, uint structKind, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength, ScriptSymbolIndex::Builder * symbolsBuilder);
+  /* Add the nodes of a symbol found while parsing a script, or read from the
+   * symbol index. The symbol is recorded in the symbolsBuilder, if any. The
+   * returned boolean means we should escape the symbol scanning process. */
+  bool loadSymbol(ScriptSymbolIndex::Symbol::Type type, qstr name, const char * scriptName, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules, ScriptSymbolIndex::Builder * symbolsBuilder = nullptr);
+  bool loadImportedName(const char * name, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules);
+  void loadImportedSource(const char * sourceName, const char * textToAutocomplete, int textToAutocompleteLength, bool importFromModules);
   /* Add a node if it completes the text to autocomplete and if it is not
    * already contained in the variable box. The returned boolean means we
    * should escape the node scanning process (due to the lexicographical order
@@ -106,6 +113,7 @@ private:
   ScriptNodeCell m_itemCells[k_maxNumberOfDisplayedItems];
   MessageTableCell m_subtitleCells[k_scriptOriginsCount];
   ScriptStore * m_scriptStore;
+  ScriptSymbolIndex m_symbolIndex;
   size_t m_currentScriptNodesCount;
   size_t m_builtinNodesCount;
   size_t m_importedNodesCount;
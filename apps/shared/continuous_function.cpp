@@ -205,6 +205,23 @@ Poincare::Coordinate2D<T> ContinuousFunction::privateEvaluateXYAtParameter(T t,
   return Coordinate2D<T>(x1x2.x2() * std::cos(angle), x1x2.x2() * std::sin(angle));
 }
 
+void ContinuousFunction::privateEvaluateYAtAbscissae(const float * x, float * y, int numberOfValues, Poincare::Context * context) const {
+  assert(plotType() == PlotType::Cartesian);
+  const ApproximationProgram * program = m_model.approximationProgram(expressionReduced(context), context);
+  if (program != nullptr) {
+    program->approximateWithValuesForSymbol(x, y, numberOfValues);
+  }
+  float min = tMin();
+  float max = tMax();
+  for (int i = 0; i < numberOfValues; i++) {
+    if (x[i] < min || x[i] > max) {
+      y[i] = NAN;
+    } else if (program == nullptr) {
+      y[i] = privateEvaluateXYAtParameter(x[i], context).x2();
+    }
+  }
+}
+
 bool ContinuousFunction::displayDerivative() const {
   return recordData()->displayDerivative();
 }
@@ -309,7 +326,10 @@ void ContinuousFunction::rangeForDisplay(float * xMin, float * xMax, float * yMi
     /* The function's order of magnitude cannot be computed. Try to just display
      * the full function. */
     float step =  (*xMax - *xMin) / k_polarParamRangeSearchNumberOfPoints;
-    Zoom::FullRange(evaluation, *xMin, *xMax, step, yMin, yMax, context, this);
+    Zoom::ValuesAtAbscissae evaluations = [](const float * x, float * values, int numberOfValues, Context * context, const void * auxiliary) {
+      static_cast<const ContinuousFunction *>(auxiliary)->privateEvaluateYAtAbscissae(x, values, numberOfValues, context);
+    };
+    Zoom::FullRange(evaluations, *xMin, *xMax, step, yMin, yMax, context, this);
     if (std::isfinite(*xMin) && std::isfinite(*xMax) && std::isfinite(*yMin) && std::isfinite(*yMax)) {
       return;
     }
@@ -331,6 +351,25 @@ size_t ContinuousFunction::Model::expressionSize(const Ion::Storage::Record * re
   return record->value().size-sizeof(RecordDataBuffer);
 }
 
+void ContinuousFunction::Model::tidy() const {
+  ExpressionModel::tidy();
+  m_approximationProgram.reset();
+  m_approximationProgramIsUpToDate = false;
+}
+
+const ApproximationProgram * ContinuousFunction::Model::approximationProgram(const Expression expressionReduced, Context * context) const {
+  if (!m_approximationProgramIsUpToDate) {
+    constexpr int bufferSize = CodePoint::MaxCodePointCharLength + 1;
+    char unknown[bufferSize];
+    SerializationHelper::CodePoint(unknown, bufferSize, UCodePointUnknown);
+    Preferences * preferences = Preferences::sharedPreferences();
+    Preferences::ComplexFormat complexFormat = Expression::UpdatedComplexFormatWithExpressionInput(preferences->complexFormat(), expressionReduced, context);
+    m_approximationProgram.compile(expressionReduced, unknown, context, complexFormat, preferences->angleUnit());
+    m_approximationProgramIsUpToDate = true;
+  }
+  return m_approximationProgram.isCompiled() ? &m_approximationProgram : nullptr;
+}
+
 ContinuousFunction::RecordDataBuffer * ContinuousFunction::recordData() const {
   assert(!isNull());
   Ion::Storage::Record::Data d = value();
@@ -349,6 +388,10 @@ Coordinate2D<T> ContinuousFunction::templatedApproximateAtParameter(T t, Poincar
   Expression e = expressionReduced(context);
   if (type != PlotType::Parametric) {
     assert(type == PlotType::Cartesian || type == PlotType::Polar);
+    const ApproximationProgram * program = m_model.approximationProgram(e, context);
+    if (program != nullptr) {
+      return Coordinate2D<T>(t, program->approximateWithValueForSymbol(t));
+    }
     return Coordinate2D<T>(t, PoincareHelpers::ApproximateWithValueForSymbol(e, unknown, t, context));
   }
   assert(e.type() == ExpressionNode::Type::Matrix);
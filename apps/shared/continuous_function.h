@@ -13,6 +13,7 @@
 #include "continuous_function_cache.h"
 #include "function.h"
 #include "range_1D.h"
+#include <poincare/approximation_program.h>
 #include <poincare/symbol.h>
 #include <poincare/coordinate_2D.h>
 
@@ -90,6 +91,8 @@ private:
   typedef Poincare::Coordinate2D<double> (*ComputePointOfInterest)(Poincare::Expression e, char * symbol, double start, double step, double max, Poincare::Context * context);
   Poincare::Coordinate2D<double> nextPointOfInterestFrom(double start, double step, double max, Poincare::Context * context, ComputePointOfInterest compute) const;
   template <typename T> Poincare::Coordinate2D<T> privateEvaluateXYAtParameter(T t, Poincare::Context * context) const;
+  // Evaluate a cartesian function on an array of abscissae at once
+  void privateEvaluateYAtAbscissae(const float * x, float * y, int numberOfValues, Poincare::Context * context) const;
   void didBecomeInactive() override { m_cache = nullptr; }
 
   void fullXYRange(float * xMin, float * xMax, float * yMin, float * yMax, Poincare::Context * context) const;
@@ -123,9 +126,17 @@ private:
     //char m_expression[0];
   };
   class Model : public ExpressionModel {
+  public:
+    Model() : ExpressionModel(), m_approximationProgramIsUpToDate(false) {}
+    void tidy() const override;
+    const Poincare::ApproximationProgram * approximationProgram(const Poincare::Expression expressionReduced, Poincare::Context * context) const;
   private:
     void * expressionAddress(const Ion::Storage::Record * record) const override;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    /* The reduced expression compiled for fast approximations. It is compiled
+     * on the first approximation and discarded with the reduced expression. */
+    mutable Poincare::ApproximationProgram m_approximationProgram;
+    mutable bool m_approximationProgramIsUpToDate;
   };
   size_t metaDataSize() const override { return sizeof(RecordDataBuffer); }
   const ExpressionModel * model() const override { return &m_model; }
@@ -6,6 +6,7 @@ namespace Shared {
 
 constexpr int ContinuousFunctionCache::k_sizeOfCache;
 constexpr float ContinuousFunctionCache::k_cacheHitTolerance;
+constexpr int ContinuousFunctionCache::k_numberOfValuesFilledAtOnce;
 constexpr int ContinuousFunctionCache::k_numberOfAvailableCaches;
 
 // public
@@ -107,8 +108,8 @@ int ContinuousFunctionCache::indexForParameter(const ContinuousFunction * functi
 
 Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i) {
   if (function->plotType() == ContinuousFunction::PlotType::Cartesian) {
-    if (std::isnan(m_cache[i])) {
-      m_cache[i] = function->privateEvaluateXYAtParameter(t, context).x2();
+    if (IsMissing(m_cache[i])) {
+      fillCartesianValuesFromIndex(function, context, t, i);
     }
     return Poincare::Coordinate2D<float>(t, m_cache[i]);
   }
@@ -120,6 +121,26 @@ Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(const Conti
   return Poincare::Coordinate2D<float>(m_cache[2 * i], m_cache[2 * i + 1]);
 }
 
+void ContinuousFunctionCache::fillCartesianValuesFromIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i) {
+  assert(function->plotType() == ContinuousFunction::PlotType::Cartesian);
+  float abscissae[k_numberOfValuesFilledAtOnce];
+  float values[k_numberOfValuesFilledAtOnce];
+  /* The following abscissae are computed the way the curve view computes
+   * them, so that the values match the parameters that will be looked up. */
+  int indexOfT = std::round((t - m_tMin) / m_tStep);
+  abscissae[0] = t;
+  int numberOfValues = 1;
+  // Do not wrap around the end of the displayed range
+  while (numberOfValues < k_numberOfValuesFilledAtOnce && indexOfT + numberOfValues < k_sizeOfCache && IsMissing(m_cache[(i + numberOfValues) % k_sizeOfCache])) {
+    abscissae[numberOfValues] = m_tMin + (indexOfT + numberOfValues) * m_tStep;
+    numberOfValues++;
+  }
+  function->privateEvaluateYAtAbscissae(abscissae, values, numberOfValues, context);
+  for (int j = 0; j < numberOfValues; j++) {
+    m_cache[(i + j) % k_sizeOfCache] = std::isnan(values[j]) ? -NAN : values[j];
+  }
+}
+
 void ContinuousFunctionCache::pan(ContinuousFunction * function, float newTMin) {
   assert(function->plotType() == ContinuousFunction::PlotType::Cartesian);
   if (newTMin == m_tMin) {
@@ -3,6 +3,7 @@
 
 #include "../graph/graph/graph_view.h"
 #include <ion/display.h>
+#include <cmath>
 #include <poincare/context.h>
 #include <poincare/coordinate_2D.h>
 
@@ -36,11 +37,18 @@ private:
    * The value 128*FLT_EPSILON has been found to be the lowest for which all
    * indices verify indexForParameter(tMin + index * tStep) = index. */
   static constexpr float k_cacheHitTolerance = 128.0f * FLT_EPSILON;
+  /* Cartesian curves are drawn from left to right: on a miss, the following
+   * missing values are approximated at once. */
+  static constexpr int k_numberOfValuesFilledAtOnce = 16;
+  /* Missing values are NAN, while undefined values of cartesian functions are
+   * stored as -NAN so that they are not approximated again. */
+  static bool IsMissing(float value) { return std::isnan(value) && !std::signbit(value); }
 
   void invalidateBetween(int iInf, int iSup);
   void setRange(ContinuousFunction * function, float tMin, float tStep);
   int indexForParameter(const ContinuousFunction * function, float t) const;
   Poincare::Coordinate2D<float> valuesAtIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i);
+  void fillCartesianValuesFromIndex(const ContinuousFunction * function, Poincare::Context * context, float t, int i);
   void pan(ContinuousFunction * function, float newTMin);
 
   float m_tMin, m_tStep;
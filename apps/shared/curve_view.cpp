@@ -622,6 +622,51 @@ const uint8_t thickStampMask[(thickStampSize+1)*(thickStampSize+1)] = {
 #endif
 
 constexpr static int k_maxNumberOfIterations = 10;
+constexpr static int k_maxStampBatchArea = 256;
+
+/* The (pxf, pyf) coordinates are not generally locating the center of a
+ * pixel. We use stampMask, which is one pixel wider and higher than stampSize,
+ * in order to cover stampRect without aligning the pixels. Then the shifted
+ * mask is computed so that each pixel is the average of the values of the four
+ * pixels of stampMask by which it is covered, proportionally to the area of
+ * the intersection with each of those.
+ *
+ * In order to compute the coordinates (px, py) of the top-left pixel of
+ * stampRect, we consider that stampMask is centered at the provided point
+ * (pxf,pyf) which is then translated to the center of the top-left pixel of
+ * stampMask. */
+
+static KDRect StampRectAtLocation(float pxf, float pyf, bool thick) {
+  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
+  return KDRect(std::ceil(pxf - stampSize/2.0f), std::ceil(pyf - stampSize/2.0f), stampSize, stampSize);
+}
+
+static void MultiplyStampMask(float pxf, float pyf, bool thick, KDRect maskRect, uint8_t * mask) {
+  /* Multiply the shifted mask of the stamp into mask, which covers maskRect.
+   * As in KDColor::blend, masks are scaled by 256, except the initial 0xFF
+   * which leaves the pixel unchanged. */
+  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
+  const uint8_t * stampMask = thick ? thickStampMask : thinStampMask;
+  pxf -= stampSize/2.0f;
+  pyf -= stampSize/2.0f;
+  const KDCoordinate px = std::ceil(pxf);
+  const KDCoordinate py = std::ceil(pyf);
+  assert(maskRect.containsRect(KDRect(px, py, stampSize, stampSize)));
+  const float dx = px - pxf;
+  const float dy = py - pyf;
+  /* TODO: this could be optimized by precomputing 10 or 100 shifted masks. The
+   * dx and dy would be rounded to one tenth or one hundredth to choose the
+   * right shifted mask. */
+  const KDCoordinate stampMaskSize = stampSize + 1;
+  for (int i=0; i<stampSize; i++) {
+    for (int j=0; j<stampSize; j++) {
+      uint8_t shiftedMask = (1.0f - dx) * (stampMask[j*stampMaskSize+i]*(1.0-dy)+stampMask[(j+1)*stampMaskSize+i]*dy)
+        + dx * (stampMask[j*stampMaskSize+(i+1)]*(1.0f-dy) + stampMask[(j+1)*stampMaskSize+(i+1)]*dy);
+      uint8_t * maskPixel = mask + (py - maskRect.y() + j) * maskRect.width() + px - maskRect.x() + i;
+      *maskPixel = *maskPixel == 0xFF ? shiftedMask : (*maskPixel * shiftedMask) >> 8;
+    }
+  }
+}
 
 void CurveView::drawCurve(KDContext * ctx, KDRect rect, float tStart, float tEnd, float tStep, EvaluateXYForFloatParameter xyFloatEvaluation, void * model, void * context, bool drawStraightLinesEarly, KDColor color, bool thick, bool colorUnderCurve, float colorLowerBound, float colorUpperBound, EvaluateXYForDoubleParameter xyDoubleEvaluation) const {
   float previousT = NAN;
@@ -960,51 +1005,61 @@ void CurveView::straightJoinDots(KDContext * ctx, KDRect rect, float pxf, float
   const float stepX = deltaX / normsRatio ;
   const float stepY = deltaY / normsRatio;
   const int numberOfStamps = std::floor(normsRatio);
-  for (int i = 0; i < numberOfStamps; i++) {
-    stampAtLocation(ctx, rect, puf, pvf, color, thick);
-    puf += stepX;
-    pvf += stepY;
+  /* Consecutive stamps overlap. Instead of blending them one by one, they are
+   * gathered by batches whose bounding rect fits in k_maxStampBatchArea
+   * pixels, and each batch is blended at once. Blending a pixel with the
+   * masks m1 and m2 successively is blending it with m1*m2, so that the
+   * batches draw the same stamps, up to the rounding of the intermediate
+   * colors, with far fewer pulls and pushes. This matters for steep curves
+   * such as tan(x), whose segments are hundreds of stamps long. */
+  uint8_t batchMask[k_maxStampBatchArea];
+  KDColor workingBuffer[k_maxStampBatchArea];
+  int i = 0;
+  while (i < numberOfStamps) {
+    KDRect batchRect = StampRectAtLocation(puf, pvf, thick);
+    int numberOfBatchedStamps = 1;
+    float batchEndX = puf + stepX;
+    float batchEndY = pvf + stepY;
+    while (i + numberOfBatchedStamps < numberOfStamps) {
+      KDRect extendedRect = batchRect.unionedWith(StampRectAtLocation(batchEndX, batchEndY, thick));
+      if (extendedRect.width() * extendedRect.height() > k_maxStampBatchArea) {
+        break;
+      }
+      batchRect = extendedRect;
+      numberOfBatchedStamps++;
+      batchEndX += stepX;
+      batchEndY += stepY;
+    }
+    if (rect.intersects(batchRect)) {
+      memset(batchMask, 0xFF, batchRect.width() * batchRect.height());
+      for (int j = 0; j < numberOfBatchedStamps; j++) {
+        // Stamps out of rect are left out, as stampAtLocation does
+        if (rect.intersects(StampRectAtLocation(puf, pvf, thick))) {
+          MultiplyStampMask(puf, pvf, thick, batchRect, batchMask);
+        }
+        puf += stepX;
+        pvf += stepY;
+      }
+      ctx->blendRectWithMask(batchRect, color, batchMask, workingBuffer);
+    } else {
+      puf = batchEndX;
+      pvf = batchEndY;
+    }
+    i += numberOfBatchedStamps;
   }
 }
 
 void CurveView::stampAtLocation(KDContext * ctx, KDRect rect, float pxf, float pyf, KDColor color, bool thick) const {
-  /* The (pxf, pyf) coordinates are not generally locating the center of a
-   * pixel. We use stampMask, which is one pixel wider and higher than
-   * stampSize, in order to cover stampRect without aligning the pixels. Then
-   * shiftedMask is computed so that each pixel is the average of the values of
-   * the four pixels of stampMask by which it is covered, proportionally to the
-   * area of the intersection with each of those.
-   *
-   * In order to compute the coordinates (px, py) of the top-left pixel of
-   * stampRect, we consider that stampMask is centered at the provided point
-   * (pxf,pyf) which is then translated to the center of the top-left pixel of
-   * stampMask.
-   */
-  KDCoordinate stampSize = thick ? thickStampSize : thinStampSize;
-  const uint8_t * stampMask = thick ? thickStampMask : thinStampMask;
-  pxf -= (stampSize + 1 - 1)/2.0f;
-  pyf -= (stampSize + 1 - 1)/2.0f;
-  const KDCoordinate px = std::ceil(pxf);
-  const KDCoordinate py = std::ceil(pyf);
-  KDRect stampRect(px, py, stampSize, stampSize);
+  KDRect stampRect = StampRectAtLocation(pxf, pyf, thick);
   if (!rect.intersects(stampRect)) {
     return;
   }
-  uint8_t shiftedMask[stampSize][stampSize];
-  KDColor workingBuffer[stampSize*stampSize];
-  const float dx = px - pxf;
-  const float dy = py - pyf;
-  /* TODO: this could be optimized by precomputing 10 or 100 shifted masks. The
-   * dx and dy would be rounded to one tenth or one hundredth to choose the
-   * right shifted mask. */
-  const KDCoordinate stampMaskSize = stampSize + 1;
-  for (int i=0; i<stampSize; i++) {
-    for (int j=0; j<stampSize; j++) {
-      shiftedMask[j][i] = (1.0f - dx) * (stampMask[j*stampMaskSize+i]*(1.0-dy)+stampMask[(j+1)*stampMaskSize+i]*dy)
-        + dx * (stampMask[j*stampMaskSize+(i+1)]*(1.0f-dy) + stampMask[(j+1)*stampMaskSize+(i+1)]*dy);
-    }
-  }
-  ctx->blendRectWithMask(stampRect, color, (const uint8_t *)shiftedMask, workingBuffer);
+  constexpr KDCoordinate maxStampArea = thickStampSize * thickStampSize;
+  uint8_t shiftedMask[maxStampArea];
+  KDColor workingBuffer[maxStampArea];
+  memset(shiftedMask, 0xFF, maxStampArea);
+  MultiplyStampMask(pxf, pyf, thick, stampRect, shiftedMask);
+  ctx->blendRectWithMask(stampRect, color, shiftedMask, workingBuffer);
 }
 
 void CurveView::layoutSubviews(bool force) {
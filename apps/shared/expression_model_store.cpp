@@ -1,9 +1,11 @@
 #include "expression_model_store.h"
+#include <algorithm>
 
 namespace Shared {
 
 ExpressionModelStore::ExpressionModelStore() :
-  m_oldestMemoizedIndex(0)
+  m_oldestMemoizedIndex(0),
+  m_memoizedModelsGeneration(0)
 {
 }
 
@@ -36,6 +38,20 @@ void ExpressionModelStore::removeModel(Ion::Storage::Record record) {
   record.destroy();
 }
 
+void ExpressionModelStore::storageDidChangeForRecord(const Ion::Storage::Record record) const {
+  /* Expressions can only refer to variables, functions and sequences: other
+   * records, like scripts, do not outdate the memoized models. */
+  Ion::Storage * storage = Ion::Storage::sharedStorage();
+  uint32_t generation = std::max(storage->generationOfRecordsWithExtension(Ion::Storage::expExtension),
+      std::max(storage->generationOfRecordsWithExtension(Ion::Storage::funcExtension),
+        storage->generationOfRecordsWithExtension(Ion::Storage::seqExtension)));
+  if (generation == m_memoizedModelsGeneration) {
+    return;
+  }
+  m_memoizedModelsGeneration = generation;
+  resetMemoizedModelsExceptRecord(record);
+}
+
 void ExpressionModelStore::tidy() {
   resetMemoizedModelsExceptRecord();
 }
@@ -35,7 +35,7 @@ public:
 
   // Other
   virtual void tidy();
-  void storageDidChangeForRecord(const Ion::Storage::Record record) const { resetMemoizedModelsExceptRecord(record); }
+  void storageDidChangeForRecord(const Ion::Storage::Record record) const;
 protected:
   constexpr static int k_maxNumberOfMemoizedModels = 10;
   int maxNumberOfMemoizedModels() const { return maxNumberOfModels() < 0 ? k_maxNumberOfMemoizedModels : maxNumberOfModels(); }
@@ -57,6 +57,8 @@ private:
    * same time. Otherwise, we should use a queue to decide which was the last
    * memoized model. */
   mutable int m_oldestMemoizedIndex;
+  // Storage generation of the records the memoized models may depend on
+  mutable uint32_t m_memoizedModelsGeneration;
 };
 
 }
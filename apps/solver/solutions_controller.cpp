@@ -118,6 +118,7 @@ void SolutionsController::viewWillAppear() {
     requireWarning = true;
   }
   m_contentView.setWarning(requireWarning);
+  m_cumulatedHeights.resetFromIndex(0);
   m_contentView.selectableTableView()->reloadData();
   selectCellAtLocation(0, 0);
 }
@@ -29,6 +29,8 @@ public:
   void willDisplayCellAtLocation(HighlightCell * cell, int i, int j) override;
   KDCoordinate columnWidth(int i) override;
   KDCoordinate rowHeight(int j) override;
+  KDCoordinate cumulatedHeightFromIndex(int j) override { return m_cumulatedHeights.cumulatedHeightFromIndex(this, j); }
+  int indexFromCumulatedHeight(KDCoordinate offsetY) override { return m_cumulatedHeights.indexFromCumulatedHeight(this, offsetY); }
   KDCoordinate cumulatedWidthFromIndex(int i) override;
   int indexFromCumulatedWidth(KDCoordinate offsetX) override;
   HighlightCell * reusableCell(int index, int type) override;
@@ -108,6 +110,8 @@ private:
   Shared::ScrollableTwoExpressionsCell m_exactValueCells[k_numberOfExactValueCells];
   EvenOddBufferTextCell m_approximateValueCells[k_numberOfApproximateValueCells];
   MessageCell m_messageCells[k_numberOfMessageCells];
+  // Row heights are computed by laying out the solutions
+  MemoizedCumulatedHeightsWithBuffer<k_maxNumberOfSymbols + 1> m_cumulatedHeights;
   ContentView m_contentView;
 };
 
@@ -64,6 +64,14 @@ $(BUILD_DIR)/test.$(EXE): $(call flavored_object_for,$(test_runner_src),consoled
 
 HANDY_TARGETS += test
 
+# Benchmarks
+
+bench_src = $(base_src) $(apps_tests_src) $(bench_runner_src) $(benchs_src)
+
+$(BUILD_DIR)/bench.$(EXE): $(call flavored_object_for,$(bench_src),consoledisplay)
+
+HANDY_TARGETS += bench
+
 # Load platform-specific targets
 # We include them before the standard ones to give them precedence.
 -include build/targets.$(PLATFORM).mak
@@ -11,6 +11,7 @@
 #include <escher/chevron_view.h>
 #include <escher/clipboard.h>
 #include <escher/container.h>
+#include <escher/dirty_region.h>
 #include <escher/expression_field.h>
 #include <escher/editable_field.h>
 #include <escher/editable_text_cell.h>
@@ -38,6 +39,7 @@
 #include <escher/layout_field.h>
 #include <escher/layout_field_delegate.h>
 #include <escher/list_view_data_source.h>
+#include <escher/memoized_cumulated_heights.h>
 #include <escher/message_table_cell.h>
 #include <escher/message_table_cell_with_buffer.h>
 #include <escher/message_table_cell_with_chevron.h>
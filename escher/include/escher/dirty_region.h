@@ -0,0 +1,28 @@
+#ifndef ESCHER_DIRTY_REGION_H
+#define ESCHER_DIRTY_REGION_H
+
+#include <kandinsky/rect.h>
+
+/* A DirtyRegion is a union of a few disjoint rectangles. Unioning two distant
+ * rectangles into their bounding rectangle would redraw everything between
+ * them: rectangles are only merged when their bounding rectangle is not much
+ * larger than them, or when there is no room left. The rectangles are kept
+ * disjoint so that no pixel is drawn twice: the overlap of distant rectangles
+ * is cut out of one of them when possible, and they are merged otherwise. */
+
+class DirtyRegion {
+public:
+  constexpr static int k_maxNumberOfRects = 2; // Each rectangle costs 8 bytes per view
+  DirtyRegion() : m_rects{KDRectZero, KDRectZero} {}
+  KDRect rectAtIndex(int i) const { return m_rects[i]; } // Might be empty
+  bool isEmpty() const;
+  void add(KDRect rect);
+  void clear();
+  DirtyRegion translatedBy(KDPoint p) const;
+private:
+  static uint32_t Area(KDRect rect) { return rect.width() * rect.height(); }
+  static uint32_t Waste(KDRect r1, KDRect r2);
+  KDRect m_rects[k_maxNumberOfRects];
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef ESCHER_MEMOIZED_CUMULATED_HEIGHTS_H
+#define ESCHER_MEMOIZED_CUMULATED_HEIGHTS_H
+
+#include <escher/table_view_data_source.h>
+
+/* MemoizedCumulatedHeights memoizes the cumulated heights of the first rows of
+ * a table, for data sources whose row heights are costly to compute (when they
+ * require laying out expressions for instance). The data source forwards its
+ * cumulatedHeightFromIndex and indexFromCumulatedHeight to it, and resets it
+ * from the first row whose height might have changed. Heights are memoized
+ * lazily, and offsets are turned into indexes by a binary search. The heights
+ * of the rows after the capacity are added up on each call. */
+
+class MemoizedCumulatedHeights {
+public:
+  MemoizedCumulatedHeights(KDCoordinate * cumulatedHeights, int capacity) :
+    m_cumulatedHeights(cumulatedHeights),
+    m_capacity(capacity),
+    m_numberOfMemoizedHeights(1)
+  {
+    m_cumulatedHeights[0] = 0;
+  }
+  void resetFromIndex(int j);
+  KDCoordinate cumulatedHeightFromIndex(TableViewDataSource * dataSource, int j);
+  int indexFromCumulatedHeight(TableViewDataSource * dataSource, KDCoordinate offsetY);
+private:
+  void memoizeUntilIndex(TableViewDataSource * dataSource, int j);
+  /* m_cumulatedHeights[j] is the cumulated height of the rows before j, for j
+   * lower than m_numberOfMemoizedHeights. */
+  KDCoordinate * m_cumulatedHeights;
+  int m_capacity;
+  int m_numberOfMemoizedHeights;
+};
+
+template <int N>
+class MemoizedCumulatedHeightsWithBuffer : public MemoizedCumulatedHeights {
+public:
+  MemoizedCumulatedHeightsWithBuffer() : MemoizedCumulatedHeights(m_buffer, N+1) {}
+private:
+  KDCoordinate m_buffer[N+1];
+};
+
+#endif
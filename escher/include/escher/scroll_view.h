@@ -90,6 +90,11 @@ public:
   }
   KDColor backgroundColor() const { return m_backgroundColor; }
 
+  /* Scrolling can move the pixels of the content on screen and only draw the
+   * newly exposed area. It requires the content to be only translated when the
+   * offset changes: laying it out for the new offset must not change what is
+   * displayed anywhere else. */
+  void setScrollsByMovingPixels(bool scrollsByMovingPixels) { m_scrollsByMovingPixels = scrollsByMovingPixels; }
   void setContentOffset(KDPoint offset, bool forceRelayout = false);
   KDPoint contentOffset() const { return m_dataSource->offset(); }
 
@@ -149,6 +154,7 @@ private:
   };
   Decorators m_decorators;
   KDColor m_backgroundColor;
+  bool m_scrollsByMovingPixels;
 };
 
 #endif
@@ -5,6 +5,7 @@ extern "C" {
 #include <stdint.h>
 }
 #include <kandinsky.h>
+#include <escher/dirty_region.h>
 
 #if ESCHER_VIEW_LOGGING
 #include <iostream>
@@ -27,10 +28,11 @@ namespace Shared {
 class View {
   // We only want Window to be able to invoke View::redraw
   friend class Window;
+  friend class ScrollView;
   friend class TransparentView;
   friend class Shared::RoundCursorView;
 public:
-  View() : m_frame(KDRectZero), m_superview(nullptr), m_dirtyRect(KDRectZero) {}
+  View() : m_frame(KDRectZero), m_superview(nullptr), m_dirtyRegion() {}
   View(View&& other) = default;
   View(const View& other) = delete;
   View& operator=(const View& other) = delete;
@@ -79,10 +81,22 @@ private:
   virtual View * subviewAtIndex(int index) { return nullptr; }
   virtual void layoutSubviews(bool force = false) {}
   virtual const Window * window() const;
-  KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  DirtyRegion redraw(KDRect rect, const DirtyRegion & forceRedrawRegion = DirtyRegion());
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
 
+  /* When the whole content of a view moves by the same offset, its pixels can
+   * be moved on screen rather than redrawn. screenPixelsCanBeMoved checks that
+   * the pixels on screen are up to date and drawn by the view and its
+   * subviews only. It returns the region that the view and its subviews still
+   * have to redraw. moveScreenPixels is called once the content is laid out:
+   * it moves the pixels and replaces the dirty regions of the view and its
+   * subviews by the newly exposed area and the pending region. */
+  bool screenPixelsCanBeMoved(DirtyRegion * pendingRegion);
+  void moveScreenPixels(KDPoint delta, const DirtyRegion & pendingRegion);
+  void addDirtyRegionOfSubtree(DirtyRegion * region, KDPoint origin, KDRect clippingRect);
+  void clearDirtyRegionOfSubtree();
+
   /* At destruction, subviews aren't notified that their own pointer
    * 'm_superview' is outdated. This is not an issue since all view hierarchy
    * is created or destroyed at once: when the app is packed or unpacked. The
@@ -90,7 +104,9 @@ private:
    * Otherwise, we would just have to implement the destructor to notify
    * subviews that 'm_superview = nullptr'. */
   View * m_superview;
-  KDRect m_dirtyRect;
+  DirtyRegion m_dirtyRegion;
+  // Number of pixels drawn since the last Window::redraw started
+  static uint32_t s_numberOfRedrawnPixels;
 };
 
 #endif
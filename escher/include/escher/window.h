@@ -8,6 +8,9 @@ public:
   Window() : m_contentView(nullptr) {}
   virtual void redraw(bool force = false);
   void setContentView(View * contentView);
+  /* Number of pixels drawn by the last redraw. Views are only redrawn where
+   * they are dirty, so it measures the efficiency of the dirty tracking. */
+  uint32_t numberOfRedrawnPixels() const { return s_numberOfRedrawnPixels; }
 protected:
 #if ESCHER_VIEW_LOGGING
   const char * className() const override;
@@ -0,0 +1,107 @@
+#include <escher/dirty_region.h>
+
+bool DirtyRegion::isEmpty() const {
+  for (int i = 0; i < k_maxNumberOfRects; i++) {
+    if (!m_rects[i].isEmpty()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void DirtyRegion::add(KDRect rect) {
+  if (rect.isEmpty()) {
+    return;
+  }
+  /* Merge the rectangles overlapping rect or close enough to it. The merged
+   * rectangle might in turn overlap other rectangles. */
+  bool didMerge = true;
+  while (didMerge) {
+    didMerge = false;
+    for (int i = 0; i < k_maxNumberOfRects; i++) {
+      KDRect r = m_rects[i];
+      if (r.isEmpty()) {
+        continue;
+      }
+      // Merge if the bounding rectangle is at most 3/2 of the rectangles
+      bool isClose = 2 * Waste(r, rect) <= Area(r) + Area(rect);
+      if (!isClose && !r.intersectedWith(rect).isEmpty()) {
+        /* Rather than merging distant overlapping rectangles, cut the overlap
+         * out of one of them if what remains is a rectangle. */
+        KDRect cutRect = rect.differencedWith(r);
+        if (cutRect.intersectedWith(r).isEmpty()) {
+          if (cutRect.isEmpty()) {
+            return;
+          }
+          rect = cutRect;
+          continue;
+        }
+        KDRect cutR = r.differencedWith(rect);
+        if (cutR.intersectedWith(rect).isEmpty()) {
+          m_rects[i] = cutR;
+          continue;
+        }
+      } else if (!isClose) {
+        continue;
+      }
+      rect = rect.unionedWith(r);
+      m_rects[i] = KDRectZero;
+      didMerge = true;
+    }
+  }
+  for (int i = 0; i < k_maxNumberOfRects; i++) {
+    if (m_rects[i].isEmpty()) {
+      m_rects[i] = rect;
+      return;
+    }
+  }
+  /* There is no room left: merge the two rectangles, among rect and the
+   * region's ones, that waste the fewest pixels. */
+  int bestFirstIndex = -1; // -1 stands for rect
+  int bestSecondIndex = 0;
+  uint32_t bestWaste = Waste(rect, m_rects[0]);
+  for (int i = -1; i < k_maxNumberOfRects; i++) {
+    KDRect r1 = i < 0 ? rect : m_rects[i];
+    for (int j = i + 1; j < k_maxNumberOfRects; j++) {
+      uint32_t waste = Waste(r1, m_rects[j]);
+      if (waste < bestWaste) {
+        bestWaste = waste;
+        bestFirstIndex = i;
+        bestSecondIndex = j;
+      }
+    }
+  }
+  KDRect merged = m_rects[bestSecondIndex].unionedWith(bestFirstIndex < 0 ? rect : m_rects[bestFirstIndex]);
+  m_rects[bestSecondIndex] = KDRectZero;
+  if (bestFirstIndex >= 0) {
+    m_rects[bestFirstIndex] = KDRectZero;
+    add(merged);
+    add(rect);
+  } else {
+    add(merged);
+  }
+}
+
+void DirtyRegion::clear() {
+  for (int i = 0; i < k_maxNumberOfRects; i++) {
+    m_rects[i] = KDRectZero;
+  }
+}
+
+DirtyRegion DirtyRegion::translatedBy(KDPoint p) const {
+  DirtyRegion result;
+  for (int i = 0; i < k_maxNumberOfRects; i++) {
+    if (!m_rects[i].isEmpty()) {
+      result.m_rects[i] = m_rects[i].translatedBy(p);
+    }
+  }
+  return result;
+}
+
+uint32_t DirtyRegion::Waste(KDRect r1, KDRect r2) {
+  /* The pixels of the bounding rectangle that are in neither rectangle. Disjoint
+   * rectangles are the only ones compared. */
+  uint32_t unionArea = Area(r1.unionedWith(r2));
+  uint32_t areas = Area(r1) + Area(r2);
+  return unionArea > areas ? unionArea - areas : 0;
+}
@@ -0,0 +1,71 @@
+#include <escher/memoized_cumulated_heights.h>
+#include <assert.h>
+
+void MemoizedCumulatedHeights::resetFromIndex(int j) {
+  /* The cumulated height of row j only depends on the heights of the rows
+   * before j. */
+  j = j < 0 ? 0 : j;
+  if (j + 1 < m_numberOfMemoizedHeights) {
+    m_numberOfMemoizedHeights = j + 1;
+  }
+}
+
+void MemoizedCumulatedHeights::memoizeUntilIndex(TableViewDataSource * dataSource, int j) {
+  j = j < m_capacity - 1 ? j : m_capacity - 1;
+  while (m_numberOfMemoizedHeights <= j) {
+    int k = m_numberOfMemoizedHeights - 1;
+    m_cumulatedHeights[k+1] = m_cumulatedHeights[k] + dataSource->rowHeight(k);
+    m_numberOfMemoizedHeights++;
+  }
+}
+
+KDCoordinate MemoizedCumulatedHeights::cumulatedHeightFromIndex(TableViewDataSource * dataSource, int j) {
+  memoizeUntilIndex(dataSource, j);
+  if (j < m_numberOfMemoizedHeights) {
+    return m_cumulatedHeights[j < 0 ? 0 : j];
+  }
+  int k = m_numberOfMemoizedHeights - 1;
+  KDCoordinate result = m_cumulatedHeights[k];
+  for (; k < j; k++) {
+    result += dataSource->rowHeight(k);
+  }
+  return result;
+}
+
+int MemoizedCumulatedHeights::indexFromCumulatedHeight(TableViewDataSource * dataSource, KDCoordinate offsetY) {
+  /* Same result as TableViewDataSource::indexFromCumulatedHeight: find the
+   * first row j whose cumulated height reaches offsetY. */
+  int numberOfRows = dataSource->numberOfRows();
+  // Memoize the rows until offsetY is reached, or until the capacity
+  while (m_numberOfMemoizedHeights - 1 < numberOfRows && m_numberOfMemoizedHeights < m_capacity && m_cumulatedHeights[m_numberOfMemoizedHeights - 1] < offsetY) {
+    memoizeUntilIndex(dataSource, m_numberOfMemoizedHeights);
+  }
+  int j = m_numberOfMemoizedHeights - 1;
+  if (m_cumulatedHeights[j] >= offsetY) {
+    // Binary search of the first row reaching offsetY
+    int lowerBound = 0;
+    while (lowerBound < j) {
+      int middle = (lowerBound + j) / 2;
+      if (m_cumulatedHeights[middle] < offsetY) {
+        lowerBound = middle + 1;
+      } else {
+        j = middle;
+      }
+    }
+  } else {
+    // The capacity was reached first, add up the next rows
+    KDCoordinate result = m_cumulatedHeights[j];
+    while (result < offsetY && j < numberOfRows) {
+      result += dataSource->rowHeight(j++);
+    }
+    if (result < offsetY) {
+      return numberOfRows;
+    }
+  }
+  /* Rows after numberOfRows might have been memoized by
+   * cumulatedHeightFromIndex, but are not to be considered. */
+  if (j > numberOfRows) {
+    return numberOfRows;
+  }
+  return offsetY == 0 ? j : j - 1;
+}
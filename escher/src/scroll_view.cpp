@@ -16,7 +16,8 @@ ScrollView::ScrollView(View * contentView, ScrollViewDataSource * dataSource) :
   m_bottomMargin(0),
   m_leftMargin(0),
   m_decorators(),
-  m_backgroundColor(Palette::BackgroundApps)
+  m_backgroundColor(Palette::BackgroundApps),
+  m_scrollsByMovingPixels(false)
 {
   assert(m_dataSource != nullptr);
   setDecoratorType(Decorator::Type::Bars);
@@ -30,7 +31,8 @@ ScrollView::ScrollView(ScrollView&& other) :
   m_rightMargin(other.m_rightMargin),
   m_bottomMargin(other.m_bottomMargin),
   m_leftMargin(other.m_leftMargin),
-  m_backgroundColor(other.m_backgroundColor)
+  m_backgroundColor(other.m_backgroundColor),
+  m_scrollsByMovingPixels(other.m_scrollsByMovingPixels)
 {
   setDecoratorType(other.m_decoratorType);
 }
@@ -151,8 +153,16 @@ void ScrollView::layoutSubviews(bool force) {
 }
 
 void ScrollView::setContentOffset(KDPoint offset, bool forceRelayout) {
+  KDPoint previousOffset = contentOffset();
   if (m_dataSource->setOffset(offset) || forceRelayout) {
+    View * innerView = getInnerView();
+    KDRect previousInnerFrame = innerView->m_frame;
+    DirtyRegion pendingRegion;
+    bool movePixels = m_scrollsByMovingPixels && contentOffset() != previousOffset && innerView->screenPixelsCanBeMoved(&pendingRegion);
     layoutSubviews();
+    if (movePixels && innerView->m_frame == previousInnerFrame) {
+      innerView->moveScreenPixels(previousOffset.translatedBy(contentOffset().opposite()), pendingRegion);
+    }
   }
 }
 
@@ -17,6 +17,8 @@ TextArea::TextArea(Responder * parentResponder, View * contentView, const KDFont
   InputEventHandler(nullptr),
   m_delegate(nullptr)
 {
+  // The text is only translated when scrolling
+  setScrollsByMovingPixels(true);
 }
 
 static inline void InsertSpacesAtLocation(int spacesCount, char * buffer, int bufferSize) {
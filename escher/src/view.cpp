@@ -11,16 +11,18 @@ const Window * View::window() const {
   }
 }
 
+uint32_t View::s_numberOfRedrawnPixels = 0;
+
 void View::markRectAsDirty(KDRect rect) {
-  m_dirtyRect = m_dirtyRect.unionedWith(rect);
+  m_dirtyRegion.add(rect);
 }
 
-KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
+DirtyRegion View::redraw(KDRect rect, const DirtyRegion & forceRedrawRegion) {
   /* View::redraw recursively redraws the rectangle 'rect' of the view and all
    * its subviews.
    * To optimize the function, we redraw only the union of the current dirty
-   * rectangle with a rectangle forced to be redrawn (forceRedrawRect). This
-   * rectangle is initially empty and recursively expands by unioning with the
+   * region with a region forced to be redrawn (forceRedrawRegion). This
+   * region is initially empty and recursively expands by adding the
    * rectangles that are redrawn. This process handles the case when several
    * sister views are overlapping (provided that the sister views are indexed in
    * the right order).
@@ -28,30 +30,39 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   if (window() == nullptr) {
     /* That view (and all of its subviews) is offscreen. That means so are all
      * of its subviews. So there's no point in drawing them. */
-    return KDRectZero;
+    return DirtyRegion();
   }
 
-  /* First, for the current view, the rectangle to redraw is the union of the
-   * dirty rectangle and the rectangle forced to be redrawn. The rectangle to
-   * redraw must also be included in the current view bounds and in the
-   * rectangle rect. */
-  KDRect rectNeedingRedraw = rect
-    .intersectedWith(m_dirtyRect)
-    .unionedWith(forceRedrawRect
-      .intersectedWith(bounds()));
+  /* First, for the current view, the region to redraw is the union of the
+   * dirty region and the region forced to be redrawn. The region to redraw
+   * must also be included in the current view bounds and in the rectangle
+   * rect. */
+  DirtyRegion regionNeedingRedraw;
+  for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+    regionNeedingRedraw.add(rect.intersectedWith(m_dirtyRegion.rectAtIndex(i)));
+    regionNeedingRedraw.add(forceRedrawRegion.rectAtIndex(i).intersectedWith(bounds()));
+  }
 
-  // This redraws the rectNeedingRedraw calling drawRect.
-  if (!rectNeedingRedraw.isEmpty()) {
+  /* This redraws each rectangle of the regionNeedingRedraw calling drawRect.
+   * The rectangles are disjoint, so that no pixel is drawn twice. */
+  if (!regionNeedingRedraw.isEmpty()) {
     KDPoint absOrigin = absoluteOrigin();
-    KDRect absRect = rectNeedingRedraw.translatedBy(absOrigin);
-    KDRect absClippingRect = absoluteVisibleFrame().intersectedWith(absRect);
+    KDRect absVisibleFrame = absoluteVisibleFrame();
     KDContext * ctx = KDIonContext::sharedContext();
-    ctx->setOrigin(absOrigin);
-    ctx->setClippingRect(absClippingRect);
-    this->drawRect(ctx, rectNeedingRedraw);
+    for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+      KDRect rectNeedingRedraw = regionNeedingRedraw.rectAtIndex(i);
+      if (rectNeedingRedraw.isEmpty()) {
+        continue;
+      }
+      KDRect absClippingRect = absVisibleFrame.intersectedWith(rectNeedingRedraw.translatedBy(absOrigin));
+      ctx->setOrigin(absOrigin);
+      ctx->setClippingRect(absClippingRect);
+      this->drawRect(ctx, rectNeedingRedraw);
+      s_numberOfRedrawnPixels += static_cast<uint32_t>(absClippingRect.width()) * absClippingRect.height();
+    }
   }
-  // This initializes the area that has been redrawn.
-  KDRect redrawnArea = rectNeedingRedraw;
+  // This initializes the region that has been redrawn.
+  DirtyRegion redrawnRegion = regionNeedingRedraw;
 
   // Then, let's recursively draw our children over ourself
   for (uint8_t i=0; i<numberOfSubviews(); i++) {
@@ -61,26 +72,125 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     }
     assert(subview->m_superview == this);
 
-    // We transpose rect and forcedRedrawArea in the subview coordinates.
+    // We transpose rect and the redrawn region in the subview coordinates.
     KDRect intersectionInSubview = rect
       .intersectedWith(subview->m_frame)
       .translatedBy(subview->m_frame.origin().opposite());
-    KDRect forcedRedrawAreaInSubview = redrawnArea
+    DirtyRegion forcedRedrawRegionInSubview = redrawnRegion
       .translatedBy(subview->m_frame.origin().opposite());
 
-    // We redraw the current subview by passing the rectangle previously redrawn
+    // We redraw the current subview by passing the region previously redrawn
     // (by the parent view or previous sister views) as forced to be redraw.
-    KDRect subviewRedrawnArea =
-      subview->redraw(intersectionInSubview, forcedRedrawAreaInSubview);
+    DirtyRegion subviewRedrawnRegion =
+      subview->redraw(intersectionInSubview, forcedRedrawRegionInSubview);
 
-    // We expand the redrawn area to include the area just drawn.
-    redrawnArea = redrawnArea.unionedWith(subviewRedrawnArea.translatedBy(subview->m_frame.origin()));
+    // We expand the redrawn region to include the region just drawn.
+    for (int j = 0; j < DirtyRegion::k_maxNumberOfRects; j++) {
+      redrawnRegion.add(subviewRedrawnRegion.rectAtIndex(j).translatedBy(subview->m_frame.origin()));
+    }
   }
   // Eventually, mark that we don't need to be redrawn
-  m_dirtyRect = KDRectZero;
+  m_dirtyRegion.clear();
+
+  // The function returns the whole region that has been redrawn.
+  return redrawnRegion;
+}
+
+bool View::screenPixelsCanBeMoved(DirtyRegion * pendingRegion) {
+  if (window() == nullptr) {
+    return false;
+  }
+  KDRect absVisibleFrame = absoluteVisibleFrame();
+  View * view = this;
+  while (view->m_superview != nullptr) {
+    View * superview = view->m_superview;
+    KDPoint superviewOrigin = superview->absoluteOrigin();
+    bool isSubviewOfSuperview = false;
+    for (int i = 0; i < superview->numberOfSubviews(); i++) {
+      View * sister = superview->subview(i);
+      if (sister == view) {
+        isSubviewOfSuperview = true;
+        continue;
+      }
+      if (sister == nullptr || sister->m_frame.translatedBy(superviewOrigin).intersectedWith(absVisibleFrame).isEmpty()) {
+        continue;
+      }
+      /* The pixels of the overlapping sister views would be moved too. The
+       * sister views drawn over the view itself are redrawn by
+       * moveScreenPixels. */
+      if (view != this || !isSubviewOfSuperview) {
+        return false;
+      }
+    }
+    if (!isSubviewOfSuperview) {
+      // m_superview is outdated: the view is not displayed
+      return false;
+    }
+    for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+      if (!superview->m_dirtyRegion.rectAtIndex(i).translatedBy(superviewOrigin).intersectedWith(absVisibleFrame).isEmpty()) {
+        return false;
+      }
+    }
+    view = superview;
+  }
+  pendingRegion->clear();
+  addDirtyRegionOfSubtree(pendingRegion, KDPointZero, absVisibleFrame.translatedBy(absoluteOrigin().opposite()));
+  return true;
+}
+
+void View::moveScreenPixels(KDPoint delta, const DirtyRegion & pendingRegion) {
+  KDPoint absOrigin = absoluteOrigin();
+  KDRect absVisibleFrame = absoluteVisibleFrame();
+  KDRect absSourceRect = absVisibleFrame.translatedBy(delta.opposite()).intersectedWith(absVisibleFrame);
+  if (absSourceRect.isEmpty() || !KDIonContext::sharedContext()->copyRect(absSourceRect, absSourceRect.origin().translatedBy(delta))) {
+    // Laying out the subviews already marked them as dirty
+    return;
+  }
+  clearDirtyRegionOfSubtree();
+  KDRect visibleRect = absVisibleFrame.translatedBy(absOrigin.opposite());
+  KDRect movedRect = absSourceRect.translatedBy(delta).translatedBy(absOrigin.opposite());
+  // Only the area that was not on screen needs to be drawn
+  markRectAsDirty(KDRect(visibleRect.x(), visibleRect.y(), visibleRect.width(), movedRect.top() - visibleRect.top()));
+  markRectAsDirty(KDRect(visibleRect.x(), movedRect.bottom() + 1, visibleRect.width(), visibleRect.bottom() - movedRect.bottom()));
+  markRectAsDirty(KDRect(visibleRect.x(), movedRect.y(), movedRect.left() - visibleRect.left(), movedRect.height()));
+  markRectAsDirty(KDRect(movedRect.right() + 1, movedRect.y(), visibleRect.right() - movedRect.right(), movedRect.height()));
+  // The pixels that were not up to date have been moved along
+  for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+    markRectAsDirty(pendingRegion.rectAtIndex(i).translatedBy(delta).intersectedWith(visibleRect));
+  }
+  // The sister views drawn over the view have been moved along
+  assert(m_superview != nullptr);
+  bool isAfterView = false;
+  for (int i = 0; i < m_superview->numberOfSubviews(); i++) {
+    View * sister = m_superview->subview(i);
+    if (sister == this) {
+      isAfterView = true;
+    } else if (isAfterView && sister != nullptr) {
+      m_superview->markRectAsDirty(sister->m_frame.intersectedWith(m_frame));
+    }
+  }
+}
 
-  // The function returns the total area that have been redrawn.
-  return redrawnArea;
+void View::addDirtyRegionOfSubtree(DirtyRegion * region, KDPoint origin, KDRect clippingRect) {
+  for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+    region->add(m_dirtyRegion.rectAtIndex(i).translatedBy(origin).intersectedWith(clippingRect));
+  }
+  for (int i = 0; i < numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr) {
+      subview->addDirtyRegionOfSubtree(region, origin.translatedBy(subview->m_frame.origin()), clippingRect);
+    }
+  }
+}
+
+void View::clearDirtyRegionOfSubtree() {
+  m_dirtyRegion.clear();
+  for (int i = 0; i < numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr) {
+      subview->clearDirtyRegionOfSubtree();
+    }
+  }
 }
 
 View * View::subview(int index) {
@@ -118,7 +228,7 @@ void View::setFrame(KDRect frame, bool force) {
    * can either mark an area of our superview as dirty, or mark our whole frame
    * as dirty. We pick the second option because it is more efficient. */
   markRectAsDirty(bounds());
-  // FIXME: m_dirtyRect = bounds(); would be more correct (in case the view is being shrinked)
+  // FIXME: m_dirtyRegion = bounds(); would be more correct (in case the view is being shrinked)
 
   if (!m_frame.isEmpty()) {
     layoutSubviews(force);
@@ -9,7 +9,13 @@ void Window::redraw(bool force) {
     markRectAsDirty(bounds());
   }
   Ion::Display::waitForVBlank();
+  s_numberOfRedrawnPixels = 0;
   View::redraw(bounds());
+#if ESCHER_VIEW_LOGGING
+  if (s_numberOfRedrawnPixels > 0) {
+    std::cout << "Redrawn pixels: " << s_numberOfRedrawnPixels << std::endl;
+  }
+#endif
 }
 
 void Window::setContentView(View * contentView) {
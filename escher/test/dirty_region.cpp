@@ -0,0 +1,89 @@
+#include <quiz.h>
+#include <escher/dirty_region.h>
+
+static int numberOfRects(const DirtyRegion & region) {
+  int result = 0;
+  for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+    result += !region.rectAtIndex(i).isEmpty();
+  }
+  return result;
+}
+
+static bool contains(const DirtyRegion & region, KDRect rect) {
+  for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+    if (region.rectAtIndex(i) == rect) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool areDisjoint(const DirtyRegion & region) {
+  for (int i = 0; i < DirtyRegion::k_maxNumberOfRects; i++) {
+    for (int j = i + 1; j < DirtyRegion::k_maxNumberOfRects; j++) {
+      if (region.rectAtIndex(i).intersects(region.rectAtIndex(j))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(escher_dirty_region) {
+  DirtyRegion region;
+  quiz_assert(region.isEmpty());
+  region.add(KDRectZero);
+  quiz_assert(region.isEmpty());
+
+  // Distant rectangles are not merged
+  KDRect top(0, 0, 320, 20);
+  KDRect bottom(0, 200, 320, 20);
+  region.add(top);
+  region.add(bottom);
+  quiz_assert(numberOfRects(region) == 2);
+  quiz_assert(contains(region, top) && contains(region, bottom));
+
+  // Overlapping rectangles are merged
+  region.add(KDRect(10, 10, 20, 20));
+  quiz_assert(numberOfRects(region) == 2);
+  quiz_assert(contains(region, KDRect(0, 0, 320, 30)) && contains(region, bottom));
+
+  // The overlap of distant rectangles is cut out of one of them
+  region.clear();
+  region.add(KDRect(307, 0, 13, 240));
+  region.add(KDRect(0, 233, 320, 7));
+  quiz_assert(numberOfRects(region) == 2);
+  quiz_assert(contains(region, KDRect(307, 0, 13, 240)) && contains(region, KDRect(0, 233, 307, 7)));
+  region.add(KDRect(300, 10, 20, 10));
+  quiz_assert(numberOfRects(region) == 2);
+  quiz_assert(contains(region, KDRect(300, 0, 20, 240)) && contains(region, KDRect(0, 233, 300, 7)));
+  quiz_assert(areDisjoint(region));
+
+  // Close rectangles are merged
+  region.clear();
+  region.add(KDRect(0, 0, 100, 10));
+  region.add(KDRect(0, 12, 100, 10));
+  quiz_assert(numberOfRects(region) == 1);
+  quiz_assert(contains(region, KDRect(0, 0, 100, 22)));
+
+  /* Without room left, the two rectangles wasting the fewest pixels are
+   * merged. */
+  region.clear();
+  region.add(KDRect(0, 0, 10, 10));
+  region.add(KDRect(300, 0, 10, 10));
+  region.add(KDRect(0, 200, 10, 10));
+  quiz_assert(numberOfRects(region) == 2);
+  quiz_assert(contains(region, KDRect(0, 0, 10, 210)) && contains(region, KDRect(300, 0, 10, 10)));
+  quiz_assert(areDisjoint(region));
+
+  // A merge can cover the other rectangles
+  region.add(KDRect(0, 0, 320, 240));
+  quiz_assert(numberOfRects(region) == 1);
+  quiz_assert(contains(region, KDRect(0, 0, 320, 240)));
+
+  region.clear();
+  region.add(KDRect(0, 0, 10, 10));
+  region.add(KDRect(100, 100, 10, 10));
+  DirtyRegion translatedRegion = region.translatedBy(KDPoint(-5, 5));
+  quiz_assert(contains(translatedRegion, KDRect(-5, 5, 10, 10)) && contains(translatedRegion, KDRect(95, 105, 10, 10)));
+}
@@ -0,0 +1,55 @@
+#include <quiz.h>
+#include <escher/memoized_cumulated_heights.h>
+
+class RowHeightsDataSource : public TableViewDataSource {
+public:
+  RowHeightsDataSource(int numberOfRows) : m_numberOfRows(numberOfRows), m_factor(1), m_firstScaledRow(0) {}
+  int numberOfRows() const override { return m_numberOfRows; }
+  int numberOfColumns() const override { return 1; }
+  KDCoordinate columnWidth(int i) override { return 10; }
+  // Some rows are empty to check offsets falling on several rows
+  KDCoordinate rowHeight(int j) override {
+    KDCoordinate height = j % 3 == 2 ? 0 : j % 5 + 1;
+    return j >= m_firstScaledRow ? m_factor * height : height;
+  }
+  HighlightCell * reusableCell(int index, int type) override { return nullptr; }
+  int reusableCellCount(int type) override { return 0; }
+  int typeAtLocation(int i, int j) override { return 0; }
+  void scaleRowsFrom(int j, int factor) {
+    m_firstScaledRow = j;
+    m_factor = factor;
+  }
+private:
+  int m_numberOfRows;
+  int m_factor;
+  int m_firstScaledRow;
+};
+
+static void assert_memoization_agrees_with_data_source(MemoizedCumulatedHeights * memoization, RowHeightsDataSource * dataSource) {
+  int numberOfRows = dataSource->numberOfRows();
+  KDCoordinate totalHeight = dataSource->TableViewDataSource::cumulatedHeightFromIndex(numberOfRows);
+  // Alternate the calls to memoize rows in different orders
+  for (KDCoordinate offset = -1; offset <= totalHeight + 2; offset++) {
+    quiz_assert(memoization->indexFromCumulatedHeight(dataSource, offset) == dataSource->TableViewDataSource::indexFromCumulatedHeight(offset));
+    int j = offset % (numberOfRows + 2);
+    quiz_assert(memoization->cumulatedHeightFromIndex(dataSource, j) == dataSource->TableViewDataSource::cumulatedHeightFromIndex(j));
+  }
+}
+
+QUIZ_CASE(escher_memoized_cumulated_heights) {
+  // Fewer rows than the capacity
+  RowHeightsDataSource fewRows(9);
+  MemoizedCumulatedHeightsWithBuffer<16> memoization;
+  assert_memoization_agrees_with_data_source(&memoization, &fewRows);
+
+  // More rows than the capacity
+  RowHeightsDataSource manyRows(40);
+  memoization.resetFromIndex(0);
+  assert_memoization_agrees_with_data_source(&memoization, &manyRows);
+
+  // The heights of the rows from the fifth one changed
+  manyRows.scaleRowsFrom(5, 2);
+  quiz_assert(memoization.cumulatedHeightFromIndex(&manyRows, 12) != manyRows.TableViewDataSource::cumulatedHeightFromIndex(12));
+  memoization.resetFromIndex(5);
+  assert_memoization_agrees_with_data_source(&memoization, &manyRows);
+}
@@ -20,6 +20,9 @@ namespace Display {
 void pushRect(KDRect r, const KDColor * pixels);
 void pushRectUniform(KDRect r, KDColor c);
 void pullRect(KDRect r, KDColor * pixels);
+/* Move the pixels of r to the rectangle of the same size at destination. The
+ * rectangles may overlap. */
+void copyRect(KDRect r, KDPoint destination);
 
 bool waitForVBlank();
 
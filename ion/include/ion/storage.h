@@ -100,6 +100,17 @@ public:
   void notifyChangeToDelegate(const Record r = Record()) const;
   Record::ErrorStatus notifyFullnessToDelegate() const;
 
+  /* Generations are stamps of a counter incremented by each change of the
+   * storage. Caches remember the generations they were computed with, and
+   * only need to be invalidated when the generation of the records they
+   * depend on changed. Records that are not indexed look changed by every
+   * change of the storage. */
+  uint32_t generation() const { return m_generation; }
+  uint32_t generationOfRecord(const Record record) const;
+  /* The generation of the last change of a record with the extension. The
+   * storage watches a few extensions, starting with the first call. */
+  uint32_t generationOfRecordsWithExtension(const char * extension);
+
   int numberOfRecordsWithExtension(const char * extension);
   static bool FullNameHasExtension(const char * fullName, const char * extension, size_t extensionLength);
 
@@ -122,6 +133,9 @@ public:
 
   // Useful
   static bool FullNameCompliant(const char * name);
+  /* The buffer was written without the Storage methods (by DFU for instance):
+   * index the records again, as all changed. */
+  void rebuildRecordIndex();
   
   // User by Python OS module
   int numberOfRecords();
@@ -161,6 +175,27 @@ private:
   size_t sizeOfRecordWithBaseNameAndExtension(const char * baseName, const char * extension, size_t size) const;
   size_t sizeOfRecordWithFullName(const char * fullName, size_t size) const;
   bool slideBuffer(char * position, int delta);
+
+  /* The record index maps the CRC32 of the full names of the records to their
+   * offset in the buffer, so that looking a record up does not compute the
+   * CRC32 of every record. It is an open addressing hash table with linear
+   * probing, in which empty slots have a null CRC32 (null CRC32 are refused as
+   * names). When there are too many records, the index is incomplete and
+   * lookups scan the buffer. */
+  constexpr static int k_recordIndexSize = 128;
+  constexpr static int k_maxNumberOfIndexedRecords = 3*k_recordIndexSize/4;
+  static_assert((k_recordIndexSize & (k_recordIndexSize - 1)) == 0, "k_recordIndexSize should be a power of 2");
+  int recordIndexSlot(uint32_t fullNameCRC32) const;
+  void insertInRecordIndex(uint32_t fullNameCRC32, record_size_t offset, uint32_t generation);
+  void indexAllRecords();
+  void indexRecord(const Record record, char * recordStart);
+  void unindexRecord(const Record record);
+  void shiftIndexedRecords(char * position, int delta);
+
+  constexpr static int k_maxNumberOfWatchedExtensions = 6;
+  static uint32_t ExtensionCRC32OfFullName(const char * fullName);
+  void didChangeRecord(const Record record, uint32_t extensionCRC32, uint32_t previousExtensionCRC32 = 0);
+  void didChangeAllRecords();
   class RecordIterator {
   public:
     RecordIterator(char * start) : m_recordStart(start) {}
@@ -186,6 +221,15 @@ private:
   StorageDelegate * m_delegate;
   mutable Record m_lastRecordRetrieved;
   mutable char * m_lastRecordRetrievedPointer;
+  uint32_t m_recordIndexCRC32s[k_recordIndexSize];
+  record_size_t m_recordIndexOffsets[k_recordIndexSize];
+  uint32_t m_recordIndexGenerations[k_recordIndexSize];
+  int m_numberOfIndexedRecords;
+  bool m_recordIndexIsComplete;
+  uint32_t m_generation;
+  uint32_t m_watchedExtensionCRC32s[k_maxNumberOfWatchedExtensions];
+  uint32_t m_watchedExtensionGenerations[k_maxNumberOfWatchedExtensions];
+  int m_nextWatchedExtensionIndex;
 };
 
 /* Some apps memoize records and need to be notified when a record might have
@@ -194,7 +238,9 @@ private:
  * We could have computed and compared the checksum of the storage to detect
  * storage invalidity, but profiling showed that this slows down the execution
  * (for example when scrolling the functions list).
- * We thus decided to notify a delegate when the storage changes. */
+ * We thus decided to notify a delegate when the storage changes. Delegates
+ * compare the generations of the records they depend on to ignore unrelated
+ * changes. */
 
 class StorageDelegate {
 public:
@@ -29,6 +29,12 @@ void pullRect(KDRect r, KDColor * pixels) {
   }
 }
 
+void copyRect(KDRect r, KDPoint destination) {
+  if (sFrameBufferActive) {
+    sFrameBuffer.copyRect(r, destination);
+  }
+}
+
 }
 }
 
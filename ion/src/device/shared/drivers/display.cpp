@@ -44,6 +44,24 @@ void pullRect(KDRect r, KDColor * pixels) {
   pullPixels(pixels, r.width()*r.height());
 }
 
+void copyRect(KDRect r, KDPoint destination) {
+  /* The LCD controller cannot move pixels in its memory: they are read back
+   * and pushed again line by line, in the vertical direction of the move so
+   * that overlapping lines are read before being overwritten. */
+  assert(r.width() <= Width);
+  KDColor line[Width];
+  bool downwards = destination.y() > r.y();
+  for (KDCoordinate j = 0; j < r.height(); j++) {
+    KDCoordinate y = downwards ? r.height() - 1 - j : j;
+    pullRect(KDRect(r.x(), r.y() + y, r.width(), 1), line);
+    pushRect(KDRect(destination.x(), destination.y() + y, r.width(), 1), line);
+  }
+#if USE_DMA
+  // The DMA might still be reading the stack buffer
+  waitForPendingDMAUploadCompletion();
+#endif
+}
+
 bool waitForVBlank() {
   /* Min screen frequency is 40Hz so the maximal period is T = 1/40Hz = 25ms.
    * If after T ms, we still do not have a VBlank event, just return. */
@@ -58,6 +58,26 @@ static constexpr Scenario scenari[] = {
 
 constexpr static int numberOfScenari = sizeof(scenari)/sizeof(Scenario);
 
+static int textDrawingTiming(KDContext * ctx, const KDFont * font, bool glyphByGlyph) {
+  /* Time the drawing of a console line alone, glyph by glyph as drawString
+   * used to push them, or by runs of glyphs as it now does. */
+  constexpr int numberOfLines = 100;
+  const char * line = "print(\"Hello world\")";
+  uint64_t startTime = Ion::Timing::millis();
+  for (int i = 0; i < numberOfLines; i++) {
+    if (glyphByGlyph) {
+      KDPoint position = KDPointZero;
+      for (const char * c = line; *c != 0; c++) {
+        char glyph[2] = {*c, 0};
+        position = ctx->drawString(glyph, position, font);
+      }
+    } else {
+      ctx->drawString(line, KDPointZero, font);
+    }
+  }
+  return Ion::Timing::millis() - startTime;
+}
+
 Event getEvent(int * timeout) {
   static int scenariIndex = 0;
   static int eventIndex = 0;
@@ -74,8 +94,10 @@ Event getEvent(int * timeout) {
     KDContext * ctx = KDIonContext::sharedContext();
     ctx->setOrigin(KDPointZero);
     ctx->setClippingRect(KDRect(0,0,Ion::Display::Width,Ion::Display::Height));
-    ctx->fillRect(KDRect(0,0,Ion::Display::Width,Ion::Display::Height), KDColorWhite);
     const KDFont * font = KDFont::LargeFont;
+    int textTimings[] = {textDrawingTiming(ctx, font, true), textDrawingTiming(ctx, font, false)};
+    const char * textTimingNames[] = {"Text by glyph (x100)", "Text by run (x100)"};
+    ctx->fillRect(KDRect(0,0,Ion::Display::Width,Ion::Display::Height), KDColorWhite);
     int line_height = font->glyphSize().height();
     for (int i = 0; i < numberOfScenari; i++) {
       constexpr int bufferLength = 50;
@@ -86,6 +108,14 @@ Event getEvent(int * timeout) {
       ctx->drawString(buffer, KDPoint(200, line_y), font);
       line_y += line_height;
     }
+    for (int i = 0; i < 2; i++) {
+      constexpr int bufferLength = 50;
+      char buffer[bufferLength];
+      Poincare::PrintInt::Left(textTimings[i], buffer, bufferLength);
+      ctx->drawString(textTimingNames[i], KDPoint(0, line_y), font);
+      ctx->drawString(buffer, KDPoint(200, line_y), font);
+      line_y += line_height;
+    }
     while (1) {
     }
   }
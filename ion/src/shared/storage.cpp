@@ -112,6 +112,7 @@ size_t Storage::putAvailableSpaceAtEndOfRecord(Storage::Record r) {
       nextRecord,
       (m_buffer + k_storageSize - availableStorageSize) - nextRecord);
   size_t newRecordSize = previousRecordSize + availableStorageSize;
+  shiftIndexedRecords(nextRecord, availableStorageSize);
   overrideSizeAtPosition(p, (record_size_t)newRecordSize);
   return newRecordSize;
 }
@@ -123,7 +124,10 @@ void Storage::getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableS
   memmove(nextRecord - recordAvailableSpace,
       nextRecord,
       m_buffer + k_storageSize - nextRecord);
+  shiftIndexedRecords(nextRecord, -recordAvailableSpace);
   overrideSizeAtPosition(p, (record_size_t)(previousRecordSize - recordAvailableSpace));
+  // The value was edited in place
+  didChangeRecord(r, ExtensionCRC32OfFullName(fullNameOfRecordStarting(p)));
 }
 
 uint32_t Storage::checksum() {
@@ -165,6 +169,8 @@ Storage::Record::ErrorStatus Storage::createRecordWithFullName(const char * full
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
   Record r = Record(fullName);
+  indexRecord(r, newRecordAddress);
+  didChangeRecord(r, ExtensionCRC32OfFullName(fullName));
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
@@ -191,6 +197,8 @@ Storage::Record::ErrorStatus Storage::createRecordWithExtension(const char * bas
   // Next Record is null-sized
   overrideSizeAtPosition(newRecord, 0);
   Record r = Record(fullNameOfRecordStarting(newRecordAddress));
+  indexRecord(r, newRecordAddress);
+  didChangeRecord(r, ExtensionCRC32OfFullName(fullNameOfRecordStarting(newRecordAddress)));
   notifyChangeToDelegate(r);
   m_lastRecordRetrieved = r;
   m_lastRecordRetrievedPointer = newRecordAddress;
@@ -294,6 +302,7 @@ const char * Storage::extensionOfRecordBaseNamedWithExtensions(const char * base
 
 void Storage::destroyAllRecords() {
   overrideSizeAtPosition(m_buffer, 0);
+  rebuildRecordIndex();
   notifyChangeToDelegate();
 }
 
@@ -328,7 +337,16 @@ Storage::Storage() :
   m_magicFooter(Magic),
   m_delegate(nullptr),
   m_lastRecordRetrieved(nullptr),
-  m_lastRecordRetrievedPointer(nullptr)
+  m_lastRecordRetrievedPointer(nullptr),
+  m_recordIndexCRC32s(),
+  m_recordIndexOffsets(),
+  m_recordIndexGenerations(),
+  m_numberOfIndexedRecords(0),
+  m_recordIndexIsComplete(true),
+  m_generation(1),
+  m_watchedExtensionCRC32s(),
+  m_watchedExtensionGenerations(),
+  m_nextWatchedExtensionIndex(0)
 {
   assert(m_magicHeader == Magic);
   assert(m_magicFooter == Magic);
@@ -336,6 +354,48 @@ Storage::Storage() :
   overrideSizeAtPosition(m_buffer, 0);
 }
 
+void Storage::rebuildRecordIndex() {
+  didChangeAllRecords();
+  indexAllRecords();
+}
+
+uint32_t Storage::generationOfRecord(const Record record) const {
+  int slot = (m_recordIndexIsComplete && !record.isNull()) ? recordIndexSlot(record.m_fullNameCRC32) : -1;
+  return slot < 0 ? m_generation : m_recordIndexGenerations[slot];
+}
+
+uint32_t Storage::generationOfRecordsWithExtension(const char * extension) {
+  uint32_t extensionCRC32 = Ion::crc32Byte((const uint8_t *)extension, strlen(extension));
+  if (extensionCRC32 == 0) {
+    return m_generation;
+  }
+  for (int i = 0; i < k_maxNumberOfWatchedExtensions; i++) {
+    if (m_watchedExtensionCRC32s[i] == extensionCRC32) {
+      return m_watchedExtensionGenerations[i];
+    }
+  }
+  // Watch the extension from now on, in place of the oldest watched one
+  int i = m_nextWatchedExtensionIndex;
+  m_nextWatchedExtensionIndex = (i + 1) % k_maxNumberOfWatchedExtensions;
+  m_watchedExtensionCRC32s[i] = extensionCRC32;
+  m_watchedExtensionGenerations[i] = m_generation;
+  return m_generation;
+}
+
+void Storage::indexAllRecords() {
+  m_lastRecordRetrieved = Record(nullptr);
+  m_lastRecordRetrievedPointer = nullptr;
+  memset(m_recordIndexCRC32s, 0, sizeof(m_recordIndexCRC32s));
+  m_numberOfIndexedRecords = 0;
+  m_recordIndexIsComplete = true;
+  for (char * p : *this) {
+    indexRecord(Record(fullNameOfRecordStarting(p)), p);
+    if (!m_recordIndexIsComplete) {
+      return;
+    }
+  }
+}
+
 const char * Storage::fullNameOfRecord(const Record record) {
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
@@ -355,6 +415,7 @@ Storage::Record::ErrorStatus Storage::setFullNameOfRecord(const Record record, c
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
     size_t previousNameSize = strlen(fullNameOfRecordStarting(p))+1;
+    uint32_t previousExtensionCRC32 = ExtensionCRC32OfFullName(fullNameOfRecordStarting(p));
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     size_t newRecordSize = previousRecordSize-previousNameSize+nameSize;
     if (newRecordSize >= k_maxRecordSize || !slideBuffer(p+sizeof(record_size_t)+previousNameSize, nameSize-previousNameSize)) {
@@ -362,6 +423,9 @@ Storage::Record::ErrorStatus Storage::setFullNameOfRecord(const Record record, c
     }
     overrideSizeAtPosition(p, newRecordSize);
     overrideFullNameAtPosition(p+sizeof(record_size_t), fullName);
+    unindexRecord(record);
+    indexRecord(Record(fullName), p);
+    didChangeRecord(Record(fullName), ExtensionCRC32OfFullName(fullName), previousExtensionCRC32);
     notifyChangeToDelegate(record);
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
@@ -378,6 +442,7 @@ Storage::Record::ErrorStatus Storage::setBaseNameWithExtensionOfRecord(Record re
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
     size_t previousNameSize = strlen(fullNameOfRecordStarting(p))+1;
+    uint32_t previousExtensionCRC32 = ExtensionCRC32OfFullName(fullNameOfRecordStarting(p));
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
     size_t newRecordSize = previousRecordSize-previousNameSize+nameSize;
     if (newRecordSize >= k_maxRecordSize || !slideBuffer(p+sizeof(record_size_t)+previousNameSize, nameSize-previousNameSize)) {
@@ -386,8 +451,11 @@ Storage::Record::ErrorStatus Storage::setBaseNameWithExtensionOfRecord(Record re
     overrideSizeAtPosition(p, newRecordSize);
     char * fullNamePosition = p + sizeof(record_size_t);
     overrideBaseNameWithExtensionAtPosition(fullNamePosition, baseName, extension);
+    unindexRecord(record);
     // Recompute the CRC32
     record = Record(fullNamePosition);
+    indexRecord(record, p);
+    didChangeRecord(record, ExtensionCRC32OfFullName(fullNamePosition), previousExtensionCRC32);
     notifyChangeToDelegate(record);
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
@@ -422,6 +490,7 @@ Storage::Record::ErrorStatus Storage::setValueOfRecord(Record record, Record::Da
     record_size_t fullNameSize = strlen(fullName)+1;
     overrideSizeAtPosition(p, newRecordSize);
     overrideValueAtPosition(p+sizeof(record_size_t)+fullNameSize, data.buffer, data.size);
+    didChangeRecord(record, ExtensionCRC32OfFullName(fullNameOfRecordStarting(p)));
     notifyChangeToDelegate(record);
     m_lastRecordRetrieved = record;
     m_lastRecordRetrievedPointer = p;
@@ -437,7 +506,14 @@ void Storage::destroyRecord(Record record) {
   char * p = pointerOfRecord(record);
   if (p != nullptr) {
     record_size_t previousRecordSize = sizeOfRecordStarting(p);
+    uint32_t extensionCRC32 = ExtensionCRC32OfFullName(fullNameOfRecordStarting(p));
+    unindexRecord(record);
     slideBuffer(p+previousRecordSize, -previousRecordSize);
+    if (!m_recordIndexIsComplete) {
+      // There might be few enough records left to index them all
+      indexAllRecords();
+    }
+    didChangeRecord(record, extensionCRC32);
     notifyChangeToDelegate();
   }
 }
@@ -450,6 +526,16 @@ char * Storage::pointerOfRecord(const Record record) const {
     assert(m_lastRecordRetrievedPointer != nullptr);
     return m_lastRecordRetrievedPointer;
   }
+  if (m_recordIndexIsComplete) {
+    int slot = recordIndexSlot(record.m_fullNameCRC32);
+    if (slot < 0) {
+      return nullptr;
+    }
+    char * p = const_cast<char *>(m_buffer) + m_recordIndexOffsets[slot];
+    m_lastRecordRetrieved = record;
+    m_lastRecordRetrievedPointer = p;
+    return p;
+  }
   for (char * p : *this) {
     Record currentRecord(fullNameOfRecordStarting(p));
     if (record == currentRecord) {
@@ -515,16 +601,10 @@ bool Storage::isNameOfRecordTaken(Record r, const Record * recordToExclude) {
      * name is nullptr. */
     return true;
   }
-  for (char * p : *this) {
-    Record s(fullNameOfRecordStarting(p));
-    if (recordToExclude && s == *recordToExclude) {
-      continue;
-    }
-    if (s == r) {
-      return true;
-    }
+  if (recordToExclude && r == *recordToExclude) {
+    return false;
   }
-  return false;
+  return pointerOfRecord(r) != nullptr;
 }
 
 bool Storage::FullNameCompliant(const char * fullName) {
@@ -580,9 +660,107 @@ bool Storage::slideBuffer(char * position, int delta) {
     return false;
   }
   memmove(position+delta, position, endBuffer()+sizeof(record_size_t)-position);
+  shiftIndexedRecords(position, delta);
   return true;
 }
 
+int Storage::recordIndexSlot(uint32_t fullNameCRC32) const {
+  assert(fullNameCRC32 != 0);
+  int slot = fullNameCRC32 & (k_recordIndexSize - 1);
+  while (m_recordIndexCRC32s[slot] != 0) {
+    if (m_recordIndexCRC32s[slot] == fullNameCRC32) {
+      return slot;
+    }
+    slot = (slot + 1) & (k_recordIndexSize - 1);
+  }
+  return -1;
+}
+
+void Storage::insertInRecordIndex(uint32_t fullNameCRC32, record_size_t offset, uint32_t generation) {
+  assert(m_numberOfIndexedRecords < k_recordIndexSize);
+  int slot = fullNameCRC32 & (k_recordIndexSize - 1);
+  while (m_recordIndexCRC32s[slot] != 0) {
+    slot = (slot + 1) & (k_recordIndexSize - 1);
+  }
+  m_recordIndexCRC32s[slot] = fullNameCRC32;
+  m_recordIndexOffsets[slot] = offset;
+  m_recordIndexGenerations[slot] = generation;
+  m_numberOfIndexedRecords++;
+}
+
+void Storage::indexRecord(const Record record, char * recordStart) {
+  if (!m_recordIndexIsComplete) {
+    return;
+  }
+  if (m_numberOfIndexedRecords >= k_maxNumberOfIndexedRecords) {
+    // The probe sequences would get too long, scan the buffer instead
+    m_recordIndexIsComplete = false;
+    return;
+  }
+  insertInRecordIndex(record.m_fullNameCRC32, recordStart - m_buffer, m_generation);
+}
+
+void Storage::unindexRecord(const Record record) {
+  if (!m_recordIndexIsComplete) {
+    return;
+  }
+  int slot = recordIndexSlot(record.m_fullNameCRC32);
+  if (slot < 0) {
+    return;
+  }
+  m_recordIndexCRC32s[slot] = 0;
+  m_numberOfIndexedRecords--;
+  /* Insert again the following records of the probe sequence, which could
+   * otherwise no longer be reached. */
+  slot = (slot + 1) & (k_recordIndexSize - 1);
+  while (m_recordIndexCRC32s[slot] != 0) {
+    uint32_t crc32 = m_recordIndexCRC32s[slot];
+    m_recordIndexCRC32s[slot] = 0;
+    m_numberOfIndexedRecords--;
+    insertInRecordIndex(crc32, m_recordIndexOffsets[slot], m_recordIndexGenerations[slot]);
+    slot = (slot + 1) & (k_recordIndexSize - 1);
+  }
+}
+
+uint32_t Storage::ExtensionCRC32OfFullName(const char * fullName) {
+  const char * dotChar = UTF8Helper::CodePointSearch(fullName, k_dotChar);
+  const char * extension = *dotChar == 0 ? dotChar : dotChar + 1;
+  return Ion::crc32Byte((const uint8_t *)extension, strlen(extension));
+}
+
+void Storage::didChangeRecord(const Record record, uint32_t extensionCRC32, uint32_t previousExtensionCRC32) {
+  m_generation++;
+  int slot = (m_recordIndexIsComplete && !record.isNull()) ? recordIndexSlot(record.m_fullNameCRC32) : -1;
+  if (slot >= 0) {
+    m_recordIndexGenerations[slot] = m_generation;
+  }
+  for (int i = 0; i < k_maxNumberOfWatchedExtensions; i++) {
+    uint32_t watchedCRC32 = m_watchedExtensionCRC32s[i];
+    if (watchedCRC32 != 0 && (watchedCRC32 == extensionCRC32 || watchedCRC32 == previousExtensionCRC32)) {
+      m_watchedExtensionGenerations[i] = m_generation;
+    }
+  }
+}
+
+void Storage::didChangeAllRecords() {
+  m_generation++;
+  for (int i = 0; i < k_maxNumberOfWatchedExtensions; i++) {
+    m_watchedExtensionGenerations[i] = m_generation;
+  }
+}
+
+void Storage::shiftIndexedRecords(char * position, int delta) {
+  if (!m_recordIndexIsComplete) {
+    return;
+  }
+  record_size_t offset = position - m_buffer;
+  for (int slot = 0; slot < k_recordIndexSize; slot++) {
+    if (m_recordIndexCRC32s[slot] != 0 && m_recordIndexOffsets[slot] >= offset) {
+      m_recordIndexOffsets[slot] += delta;
+    }
+  }
+}
+
 Storage::Record Storage::privateRecordAndExtensionOfRecordBaseNamedWithExtensions(const char * baseName, const char * const extensions[], size_t numberOfExtensions, const char * * extensionResult, int baseNameLength) {
   size_t nameLength = baseNameLength < 0 ? strlen(baseName) : baseNameLength;
   {
@@ -599,6 +777,29 @@ Storage::Record Storage::privateRecordAndExtensionOfRecordBaseNamedWithExtension
       }
     }
   }
+  if (m_recordIndexIsComplete) {
+    // Look each full name up, and keep the first record in the buffer
+    int resultSlot = -1;
+    size_t resultExtensionIndex = 0;
+    for (size_t i = 0; i < numberOfExtensions; i++) {
+      Record r(baseName, nameLength, extensions[i], strlen(extensions[i]));
+      int slot = r.isNull() ? -1 : recordIndexSlot(r.m_fullNameCRC32);
+      if (slot >= 0 && (resultSlot < 0 || m_recordIndexOffsets[slot] < m_recordIndexOffsets[resultSlot])) {
+        resultSlot = slot;
+        resultExtensionIndex = i;
+      }
+    }
+    if (resultSlot >= 0) {
+      if (extensionResult != nullptr) {
+        *extensionResult = extensions[resultExtensionIndex];
+      }
+      return Record(fullNameOfRecordStarting(m_buffer + m_recordIndexOffsets[resultSlot]));
+    }
+    if (extensionResult != nullptr) {
+      *extensionResult = nullptr;
+    }
+    return Record();
+  }
   for (char * p : *this) {
     const char * currentName = fullNameOfRecordStarting(p);
     if (strncmp(baseName, currentName, nameLength) == 0) {
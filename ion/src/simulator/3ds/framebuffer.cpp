@@ -30,6 +30,13 @@ void pullRect(KDRect r, KDColor * pixels) {
   }
 }
 
+void copyRect(KDRect r, KDPoint destination) {
+  if (sFrameBufferActive) {
+    Simulator::Main::setNeedsRefresh();
+    sFrameBuffer.copyRect(r, destination);
+  }
+}
+
 }
 }
 
@@ -3,6 +3,7 @@
 #include <assert.h>
 #include <ion/display.h>
 #include <SDL.h>
+#include <stdio.h>
 #include <string.h>
 
 namespace Ion {
@@ -11,6 +12,17 @@ namespace Display {
 
 static SDL_Texture * sFramebufferTexture = nullptr;
 
+/* The statistics overlay shows the number of frames presented and the number
+ * of bytes uploaded to the screen texture during the last second. */
+static bool sStatisticsOverlayVisible = false;
+static SDL_Texture * sStatisticsTexture = nullptr;
+constexpr static int k_statisticsWidth = 140;
+constexpr static int k_statisticsHeight = 16;
+static KDColor sStatisticsPixels[k_statisticsWidth * k_statisticsHeight];
+static uint32_t sStatisticsStartTime = 0;
+static int sNumberOfFrames = 0;
+static int sNumberOfUploadedBytes = 0;
+
 void init(SDL_Renderer * renderer) {
   Framebuffer::setActive(true);
   Uint32 texturePixelFormat = SDL_PIXELFORMAT_RGB565;
@@ -18,26 +30,79 @@ void init(SDL_Renderer * renderer) {
   sFramebufferTexture = SDL_CreateTexture(
     renderer,
     texturePixelFormat,
-    SDL_TEXTUREACCESS_STREAMING,
+    SDL_TEXTUREACCESS_STATIC,
     Ion::Display::Width,
     Ion::Display::Height
   );
+  Framebuffer::markAllAsDirty();
+  if (sStatisticsOverlayVisible) {
+    sStatisticsTexture = SDL_CreateTexture(
+      renderer,
+      texturePixelFormat,
+      SDL_TEXTUREACCESS_STATIC,
+      k_statisticsWidth,
+      k_statisticsHeight
+    );
+    SDL_UpdateTexture(sStatisticsTexture, nullptr, sStatisticsPixels, k_statisticsWidth * sizeof(KDColor));
+    sStatisticsStartTime = SDL_GetTicks();
+  }
 }
 
 void shutdown() {
   SDL_DestroyTexture(sFramebufferTexture);
   sFramebufferTexture = nullptr;
+  if (sStatisticsTexture != nullptr) {
+    SDL_DestroyTexture(sStatisticsTexture);
+    sStatisticsTexture = nullptr;
+  }
+}
+
+void setStatisticsOverlayVisible(bool visible) {
+  sStatisticsOverlayVisible = visible;
+}
+
+static void updateStatistics(int uploadedBytes) {
+  sNumberOfFrames++;
+  sNumberOfUploadedBytes += uploadedBytes;
+  uint32_t time = SDL_GetTicks();
+  if (time - sStatisticsStartTime < 1000) {
+    return;
+  }
+  char text[32];
+  snprintf(text, sizeof(text), "%d fps %d kB/s", sNumberOfFrames, sNumberOfUploadedBytes / 1024);
+  KDFrameBuffer frameBuffer(sStatisticsPixels, KDSize(k_statisticsWidth, k_statisticsHeight));
+  KDFrameBufferContext context(&frameBuffer);
+  context.fillRect(KDRect(0, 0, k_statisticsWidth, k_statisticsHeight), KDColorBlack);
+  context.drawString(text, KDPoint(2, 2), KDFont::SmallFont, KDColorWhite, KDColorBlack);
+  SDL_UpdateTexture(sStatisticsTexture, nullptr, sStatisticsPixels, k_statisticsWidth * sizeof(KDColor));
+  sStatisticsStartTime = time;
+  sNumberOfFrames = 0;
+  sNumberOfUploadedBytes = 0;
 }
 
 void draw(SDL_Renderer * renderer, SDL_Rect * rect) {
-  int pitch = 0;
-  void * pixels = nullptr;
-  SDL_LockTexture(sFramebufferTexture, nullptr, &pixels, &pitch);
-  assert(pitch == sizeof(KDColor)*Ion::Display::Width);
-  memcpy(pixels, Framebuffer::address(), sizeof(KDColor)*Ion::Display::Width*Ion::Display::Height);
-  SDL_UnlockTexture(sFramebufferTexture);
+  int uploadedBytes = 0;
+  for (int i = 0; i < Framebuffer::numberOfDirtyRects(); i++) {
+    KDRect r = Framebuffer::dirtyRectAtIndex(i);
+    SDL_Rect textureRect = {r.x(), r.y(), r.width(), r.height()};
+    const KDColor * pixels = Framebuffer::address() + r.x() + r.y() * Ion::Display::Width;
+    SDL_UpdateTexture(sFramebufferTexture, &textureRect, pixels, Ion::Display::Width * sizeof(KDColor));
+    uploadedBytes += r.width() * r.height() * sizeof(KDColor);
+  }
+  Framebuffer::clearDirtyRects();
 
   SDL_RenderCopy(renderer, sFramebufferTexture, nullptr, rect);
+
+  if (sStatisticsTexture != nullptr) {
+    updateStatistics(uploadedBytes);
+    SDL_Rect statisticsRect = {
+      rect->x,
+      rect->y,
+      k_statisticsWidth * rect->w / Ion::Display::Width,
+      k_statisticsHeight * rect->h / Ion::Display::Height
+    };
+    SDL_RenderCopy(renderer, sStatisticsTexture, nullptr, &statisticsRect);
+  }
 }
 
 }
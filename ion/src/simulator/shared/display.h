@@ -10,6 +10,8 @@ namespace Display {
 
 void init(SDL_Renderer * renderer);
 void shutdown();
+// Must be called before init
+void setStatisticsOverlayVisible(bool visible);
 
 void draw(SDL_Renderer * renderer, SDL_Rect * rect);
 
@@ -1,20 +1,57 @@
 #include "framebuffer.h"
 #include "window.h"
 #include <ion/display.h>
+#include <assert.h>
 
 /* Drawing on an SDL texture
  * In SDL2, drawing bitmap data happens through textures, whose data lives in
  * the GPU's memory. Reading data back from a texture is not possible, so we
  * simply maintain a framebuffer in RAM since Ion::Display::pullRect expects to
  * be able to read pixel data back.
- * A side effect is that we rewrite the whole texture when redrawing the screen.
- * This might not be the most efficient way since sending pixels to the GPU is
- * rather expensive.
+ * Sending pixels to the GPU is rather expensive: only the rectangles pushed
+ * since the last refresh are uploaded to the texture.
  * This is also very useful when running headless because we can easily log the
  * framebuffer to a PNG file. */
 
 static KDColor sPixels[Ion::Display::Width * Ion::Display::Height];
 static bool sFrameBufferActive = false;
+// KDRect has no default constructor, hence the wrapper
+struct DirtyRect {
+  KDRect rect = KDRectZero;
+};
+static DirtyRect sDirtyRects[Ion::Simulator::Framebuffer::k_maxNumberOfDirtyRects];
+static int sNumberOfDirtyRects = 0;
+
+static int area(KDRect r) {
+  return r.width() * r.height();
+}
+
+static void addDirtyRect(KDRect r) {
+  Ion::Simulator::Window::setNeedsRefresh();
+  if (r.isEmpty()) {
+    return;
+  }
+  /* Glyphs of a string or lines of a curve are pushed one by one: extend a
+   * rectangle if the union wastes less than the pushed area. */
+  int bestIndex = 0;
+  int bestGrowth = -1;
+  for (int i = 0; i < sNumberOfDirtyRects; i++) {
+    int growth = area(sDirtyRects[i].rect.unionedWith(r)) - area(sDirtyRects[i].rect);
+    if (growth <= 2 * area(r)) {
+      sDirtyRects[i].rect = sDirtyRects[i].rect.unionedWith(r);
+      return;
+    }
+    if (bestGrowth < 0 || growth < bestGrowth) {
+      bestIndex = i;
+      bestGrowth = growth;
+    }
+  }
+  if (sNumberOfDirtyRects < Ion::Simulator::Framebuffer::k_maxNumberOfDirtyRects) {
+    sDirtyRects[sNumberOfDirtyRects++].rect = r;
+  } else {
+    sDirtyRects[bestIndex].rect = sDirtyRects[bestIndex].rect.unionedWith(r);
+  }
+}
 
 namespace Ion {
 namespace Display {
@@ -23,14 +60,14 @@ static KDFrameBuffer sFrameBuffer = KDFrameBuffer(sPixels, KDSize(Width, Height)
 
 void pushRect(KDRect r, const KDColor * pixels) {
   if (sFrameBufferActive) {
-    Simulator::Window::setNeedsRefresh();
+    addDirtyRect(r);
     sFrameBuffer.pushRect(r, pixels);
   }
 }
 
 void pushRectUniform(KDRect r, KDColor c) {
   if (sFrameBufferActive) {
-    Simulator::Window::setNeedsRefresh();
+    addDirtyRect(r);
     sFrameBuffer.pushRectUniform(r, c);
   }
 }
@@ -41,6 +78,13 @@ void pullRect(KDRect r, KDColor * pixels) {
   }
 }
 
+void copyRect(KDRect r, KDPoint destination) {
+  if (sFrameBufferActive) {
+    addDirtyRect(KDRect(destination, r.size()));
+    sFrameBuffer.copyRect(r, destination);
+  }
+}
+
 }
 }
 
@@ -56,6 +100,24 @@ void setActive(bool enabled) {
   sFrameBufferActive = enabled;
 }
 
+int numberOfDirtyRects() {
+  return sNumberOfDirtyRects;
+}
+
+KDRect dirtyRectAtIndex(int index) {
+  assert(index >= 0 && index < sNumberOfDirtyRects);
+  return sDirtyRects[index].rect;
+}
+
+void clearDirtyRects() {
+  sNumberOfDirtyRects = 0;
+}
+
+void markAllAsDirty() {
+  sDirtyRects[0].rect = KDRect(0, 0, Ion::Display::Width, Ion::Display::Height);
+  sNumberOfDirtyRects = 1;
+}
+
 }
 }
 }
@@ -10,6 +10,15 @@ namespace Framebuffer {
 const KDColor * address();
 void setActive(bool enabled);
 
+/* The framebuffer keeps track of the rectangles pushed since they were last
+ * uploaded to the screen texture. A rectangle is merged into one close to it.
+ * When all of them are in use, it is merged into the one it grows the least. */
+constexpr int k_maxNumberOfDirtyRects = 4;
+int numberOfDirtyRects();
+KDRect dirtyRectAtIndex(int index);
+void clearDirtyRects();
+void markAllAsDirty();
+
 }
 }
 }
@@ -1,3 +1,4 @@
+#include "display.h"
 #include "haptics.h"
 #include "journal.h"
 #include "platform.h"
@@ -91,6 +92,7 @@ int main(int argc, char * argv[]) {
     std::cout << "  -s, --screen-only         Disable the keyboard." << std::endl;
     std::cout << "  -v, --volatile            Disable saving and loading python scripts from file." << std::endl;
     std::cout << "  -u, --unresizable         Disable resizing the window." << std::endl;
+    std::cout << "  --display-statistics      Show the frame rate and the uploaded bytes." << std::endl;
     std::cout << "  -h, --help                Show this help menu." << std::endl;
     return 0;
   }
@@ -100,6 +102,7 @@ int main(int argc, char * argv[]) {
     bool screen_only = args.popFlag("--screen-only") || args.popFlag("-s");
     bool fullscreen =  args.popFlag("--fullscreen")  || args.popFlag("-f");
     bool unresizable = args.popFlag("--unresizable") || args.popFlag("-u");
+    Display::setStatisticsOverlayVisible(args.popFlag("--display-statistics"));
     Journal::init();
 #if EPSILON_TELEMETRY
     Telemetry::init();
@@ -1,5 +1,6 @@
 #include "window.h"
 #include "display.h"
+#include "framebuffer.h"
 #include "layout.h"
 #include "platform.h"
 
@@ -108,6 +109,8 @@ void relayout() {
   sScreenRect.h = windowHeight;
   #endif
 
+  // The renderer might have lost the content of the textures
+  Framebuffer::markAllAsDirty();
   setNeedsRefresh();
 }
 
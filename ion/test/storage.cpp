@@ -1,6 +1,7 @@
 #include <quiz.h>
 #include <ion/storage.h>
 #include <assert.h>
+#include <stdio.h>
 #include <string.h>
 
 using namespace Ion;
@@ -500,3 +501,90 @@ aaaaaa)";
   retrievedRecord3.destroy();
   retrievedRecord4.destroy();
 }
+
+static void assert_records_are_retrieved(int firstIndex, int lastIndex, int step) {
+  char baseName[8];
+  for (int i = firstIndex; i < lastIndex; i += step) {
+    snprintf(baseName, sizeof(baseName), "r%d", i);
+    Storage::Record r = Storage::sharedStorage()->recordBaseNamedWithExtension(baseName, "idx");
+    quiz_assert(!r.isNull());
+    quiz_assert(r.value().size == strlen(baseName));
+    quiz_assert(strncmp(static_cast<const char *>(r.value().buffer), baseName, strlen(baseName)) == 0);
+  }
+}
+
+QUIZ_CASE(ion_storage_record_index) {
+  size_t initialAvailableSize = Storage::sharedStorage()->availableSize();
+  // More records than the index can hold
+  constexpr int numberOfRecords = 110;
+  char baseName[8];
+  for (int i = 0; i < numberOfRecords; i++) {
+    snprintf(baseName, sizeof(baseName), "r%d", i);
+    quiz_assert(putRecordInSharedStorage(baseName, "idx", baseName) == Storage::Record::ErrorStatus::None);
+  }
+  assert_records_are_retrieved(0, numberOfRecords, 1);
+  quiz_assert(putRecordInSharedStorage("r42", "idx", "r42") == Storage::Record::ErrorStatus::NameTaken);
+
+  // Destroy enough records for the remaining ones to be indexed
+  for (int i = 0; i < numberOfRecords; i += 2) {
+    snprintf(baseName, sizeof(baseName), "r%d", i);
+    Storage::sharedStorage()->destroyRecordWithBaseNameAndExtension(baseName, "idx");
+  }
+  assert_records_are_retrieved(1, numberOfRecords, 2);
+  quiz_assert(Storage::sharedStorage()->recordNamed("r42.idx").isNull());
+
+  // Resize and rename records in the middle of the buffer
+  Storage::Record r = Storage::sharedStorage()->recordNamed("r51.idx");
+  quiz_assert(r.setValue({.buffer = "a longer value", .size = 14}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(r.setBaseNameWithExtension("renamed", "idx") == Storage::Record::ErrorStatus::None);
+  r = Storage::sharedStorage()->recordNamed("r53.idx");
+  quiz_assert(r.setName("r53.other") == Storage::Record::ErrorStatus::None);
+  assert_records_are_retrieved(1, 51, 2);
+  assert_records_are_retrieved(55, numberOfRecords, 2);
+  quiz_assert(Storage::sharedStorage()->recordNamed("r51.idx").isNull());
+  quiz_assert(strcmp(Storage::sharedStorage()->recordBaseNamedWithExtension("renamed", "idx").fullName(), "renamed.idx") == 0);
+
+  // Look a record up with several extensions
+  const char * extensions[] = {"idx", "other"};
+  quiz_assert(strcmp(Storage::sharedStorage()->extensionOfRecordBaseNamedWithExtensions("r53", 3, extensions, 2), "other") == 0);
+  quiz_assert(Storage::sharedStorage()->extensionOfRecordBaseNamedWithExtensions("r52", 3, extensions, 2) == nullptr);
+
+  Storage::sharedStorage()->destroyRecordsWithExtension("idx");
+  Storage::sharedStorage()->destroyRecordsWithExtension("other");
+  quiz_assert(Storage::sharedStorage()->availableSize() == initialAvailableSize);
+}
+
+QUIZ_CASE(ion_storage_generations) {
+  Storage * storage = Storage::sharedStorage();
+  quiz_assert(putRecordInSharedStorage("a", "gen1", "a") == Storage::Record::ErrorStatus::None);
+  quiz_assert(putRecordInSharedStorage("b", "gen2", "b") == Storage::Record::ErrorStatus::None);
+  Storage::Record a = storage->recordNamed("a.gen1");
+  Storage::Record b = storage->recordNamed("b.gen2");
+  uint32_t generationOfA = storage->generationOfRecord(a);
+  uint32_t generationOfGen1 = storage->generationOfRecordsWithExtension("gen1");
+  uint32_t generationOfGen2 = storage->generationOfRecordsWithExtension("gen2");
+
+  // Changing b does not change the generations of a
+  quiz_assert(b.setValue({.buffer = "bb", .size = 2}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->generationOfRecord(a) == generationOfA);
+  quiz_assert(storage->generationOfRecordsWithExtension("gen1") == generationOfGen1);
+  quiz_assert(storage->generationOfRecordsWithExtension("gen2") > generationOfGen2);
+  quiz_assert(storage->generationOfRecord(b) == storage->generation());
+
+  // Changing a does
+  quiz_assert(a.setValue({.buffer = "aa", .size = 2}) == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->generationOfRecord(a) > generationOfA);
+  quiz_assert(storage->generationOfRecordsWithExtension("gen1") > generationOfGen1);
+
+  // Renaming a record changes both its previous and its new extensions
+  generationOfGen1 = storage->generationOfRecordsWithExtension("gen1");
+  generationOfGen2 = storage->generationOfRecordsWithExtension("gen2");
+  quiz_assert(a.setName("a.gen2") == Storage::Record::ErrorStatus::None);
+  quiz_assert(storage->generationOfRecordsWithExtension("gen1") > generationOfGen1);
+  quiz_assert(storage->generationOfRecordsWithExtension("gen2") > generationOfGen2);
+
+  // Destroying a record changes its extension
+  generationOfGen2 = storage->generationOfRecordsWithExtension("gen2");
+  storage->destroyRecordsWithExtension("gen2");
+  quiz_assert(storage->generationOfRecordsWithExtension("gen2") > generationOfGen2);
+}
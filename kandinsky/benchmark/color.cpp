@@ -0,0 +1,65 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <kandinsky.h>
+
+constexpr static int k_rowLength = 320;
+static KDColor s_row[k_rowLength];
+static KDColor s_referenceRow[k_rowLength];
+static uint8_t s_alphas[k_rowLength];
+
+static void fill_rows_and_alphas() {
+  uint32_t value = 0;
+  for (int i = 0; i < k_rowLength; i++) {
+    // Linear congruential generator, to go through various colors and alphas
+    value = value * 1103515245 + 12345;
+    s_row[i] = KDColor::RGB16(value >> 16);
+    s_referenceRow[i] = s_row[i];
+    s_alphas[i] = (i % 7 == 0) ? 0xFF : (i % 11 == 0) ? 0 : value >> 8;
+  }
+}
+
+// As many rows as in a hundred screens
+constexpr static int k_numberOfRows = 100 * 240;
+
+QUIZ_CASE(kandinsky_color_blend_row_benchmark) {
+  const KDColor color = KDColor::RGB24(0x123456);
+  fill_rows_and_alphas();
+  quiz_print("Pixel by pixel, then by rows");
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int j = 0; j < k_numberOfRows; j++) {
+    for (int i = 0; i < k_rowLength; i++) {
+      s_referenceRow[i] = KDColor::blend(s_referenceRow[i], color, s_alphas[i]);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+  startTime = quiz_stopwatch_start();
+  for (int j = 0; j < k_numberOfRows; j++) {
+    KDColor::blendRow(s_row, color, s_alphas, k_rowLength);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  for (int i = 0; i < k_rowLength; i++) {
+    quiz_assert(s_row[i] == s_referenceRow[i]);
+  }
+}
+
+QUIZ_CASE(kandinsky_color_fill_row_benchmark) {
+  // Filling is much faster, time ten times more rows
+  constexpr int numberOfRows = 10 * k_numberOfRows;
+  quiz_print("Pixel by pixel, then by rows");
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int j = 0; j < numberOfRows; j++) {
+    KDColor color = KDColor::RGB16(j);
+    for (int i = 0; i < k_rowLength; i++) {
+      s_referenceRow[i] = color;
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+  startTime = quiz_stopwatch_start();
+  for (int j = 0; j < numberOfRows; j++) {
+    KDColor::fillRow(s_row, KDColor::RGB16(j), k_rowLength);
+  }
+  quiz_stopwatch_print_lap(startTime);
+  for (int i = 0; i < k_rowLength; i++) {
+    quiz_assert(s_row[i] == s_referenceRow[i]);
+  }
+}
@@ -0,0 +1,39 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <kandinsky.h>
+
+constexpr static KDCoordinate k_width = 320;
+constexpr static KDCoordinate k_height = 40;
+static KDColor s_pixels[k_width * k_height];
+
+static void time_draw_string(const char * fontName, const KDFont * font) {
+  const char * line = "print(\"Hello world\")";
+  constexpr int numberOfLines = 1000;
+  KDFrameBuffer frameBuffer(s_pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  quiz_print(fontName);
+
+  // Glyph by glyph, as drawString used to push them
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < numberOfLines; i++) {
+    KDPoint position = KDPointZero;
+    for (const char * c = line; *c != 0; c++) {
+      char glyph[2] = {*c, 0};
+      position = context.drawString(glyph, position, font);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+
+  // By runs of glyphs
+  startTime = quiz_stopwatch_start();
+  for (int i = 0; i < numberOfLines; i++) {
+    context.drawString(line, KDPointZero, font);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(kandinsky_context_draw_string_benchmark) {
+  // A thousand console lines
+  time_draw_string("Large font", KDFont::LargeFont);
+  time_draw_string("Small font", KDFont::SmallFont);
+}
@@ -32,6 +32,10 @@ public:
   }
 
   static KDColor blend(KDColor first, KDColor second, uint8_t alpha);
+  /* Row kernels, vectorized where the target has SIMD instructions.
+   * blendRow replaces each pixel with blend(pixel, color, alphas[i]). */
+  static void blendRow(KDColor * pixels, KDColor color, const uint8_t * alphas, int numberOfPixels);
+  static void fillRow(KDColor * pixels, KDColor color, int numberOfPixels);
   KDColor invert() const { return KDColor(~m_value); }
   operator uint16_t() const { return m_value; }
 private:
@@ -27,6 +27,11 @@ public:
 
   // Line. Not anti-aliased.
   void drawLine(KDPoint p1, KDPoint p2, KDColor c);
+  /* Polyline joining the points, thickness pixels wide perpendicularly to its
+   * segments. Vertices are drawn with a square pen, or blended with a
+   * thickness x thickness vertexMask when given, which then requires a working
+   * buffer of the same size. Not anti-aliased either. */
+  void drawPolyline(const KDPoint * points, int numberOfPoints, KDColor color, KDCoordinate thickness = 1, const uint8_t * vertexMask = nullptr, KDColor * workingBuffer = nullptr);
 
   // Rect
   void fillRect(KDRect rect, KDColor color);
@@ -38,9 +43,15 @@ public:
   virtual void pullRect(KDRect rect, KDColor * pixels) = 0;
 protected:
   KDContext(KDPoint origin, KDRect clippingRect);
+  /* Blend absoluteRect, which is already clipped, with a mask whose rows are
+   * maskWidth long. By default, the pixels are pulled into workingBuffer,
+   * blended and pushed back. */
+  virtual void blendAbsoluteRectWithMask(KDRect absoluteRect, KDColor color, const uint8_t * mask, KDCoordinate maskWidth, KDColor * workingBuffer);
 private:
   KDRect absoluteFillRect(KDRect rect);
   KDPoint pushOrPullString(const char * text, KDPoint p, const KDFont * font, KDColor textColor, KDColor backgroundColor, int maxByteLength, bool push, int * result = nullptr);
+  void fillLineRuns(KDPoint start, KDPoint end, KDColor color, KDCoordinate thickness);
+  void pushGlyphRun(KDPoint origin, KDSize glyphSize, int numberOfGlyphs, int glyphRunCapacity, KDColor * glyphRun);
   KDPoint m_origin;
   KDRect m_clippingRect;
 };
@@ -75,10 +75,25 @@ public:
   }
   KDSize glyphSize() const { return m_glyphSize; }
 
+  /* The same few glyphs are drawn over and over, so the most recently
+   * decompressed glyphs are kept in a small cache shared by all fonts. */
+  class GlyphCacheStatistics {
+  public:
+    uint32_t hits;
+    uint32_t misses;
+  };
+  static GlyphCacheStatistics glyphCacheStatistics();
+  static void resetGlyphCache();
+
   constexpr KDFont(size_t tableLength, const CodePointIndexPair * table, KDCoordinate glyphWidth, KDCoordinate glyphHeight, const uint16_t * glyphDataOffset, const uint8_t * data) :
     m_tableLength(tableLength), m_table(table), m_glyphSize(glyphWidth, glyphHeight), m_glyphDataOffset(glyphDataOffset), m_data(data) { }
 private:
+  static constexpr int k_glyphCacheSize = 32;
+  static constexpr int k_maxGlyphGrayscaleSize = k_maxGlyphPixelCount * k_bitsPerPixel / 8;
+  class GlyphCache;
+  static GlyphCache s_glyphCache;
   void fetchGrayscaleGlyphAtIndex(GlyphIndex index, uint8_t * grayscaleBuffer) const;
+  void decompressGrayscaleGlyphAtIndex(GlyphIndex index, uint8_t * grayscaleBuffer) const;
 
   const uint8_t * compressedGlyphData(GlyphIndex index) const {
     return m_data + m_glyphDataOffset[index];
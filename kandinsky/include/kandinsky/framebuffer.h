@@ -10,6 +10,9 @@ public:
   void pushRect(KDRect rect, const KDColor * pixels);
   void pushRectUniform(KDRect rect, KDColor color);
   void pullRect(KDRect rect, KDColor * pixels);
+  void copyRect(KDRect rect, KDPoint destination);
+  // Blend the pixels in place, the mask rows being maskWidth long
+  void blendRectWithMask(KDRect rect, KDColor color, const uint8_t * mask, KDCoordinate maskWidth);
   KDRect bounds();
 private:
   KDColor * pixelAddress(KDPoint p) const;
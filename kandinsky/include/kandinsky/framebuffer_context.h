@@ -11,6 +11,8 @@ protected:
   void pushRect(KDRect, const KDColor * pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor * pixels) override;
+  // The frame buffer is in memory, the pixels are blended in place
+  void blendAbsoluteRectWithMask(KDRect absoluteRect, KDColor color, const uint8_t * mask, KDCoordinate maskWidth, KDColor * workingBuffer) override;
 private:
   KDFrameBuffer * m_frameBuffer;
 };
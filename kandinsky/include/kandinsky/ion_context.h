@@ -18,6 +18,9 @@ class KDIonContext : public KDContext {
 public:
   static KDIonContext * sharedContext();
   void updatePostProcessingEffects();
+  /* Move the pixels of rect on screen. Return false if the post-processing
+   * effects prevent it. */
+  bool copyRect(KDRect rect, KDPoint destination);
 
   KDPostProcessInvertContext invert;
   KDPostProcessZoomContext zoom;
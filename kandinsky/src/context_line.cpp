@@ -1,59 +1,78 @@
 #include <kandinsky/context.h>
 #include <assert.h>
+#include <math.h>
+#include <stdlib.h>
 
 void KDContext::drawLine(KDPoint p1, KDPoint p2, KDColor c) {
-  // Find the largest gap
-  KDPoint left = KDPointZero, right = KDPointZero;
-  if (p2.x() > p1.x()) {
-    left = p1;
-    right = p2;
-  } else {
-    left = p2;
-    right = p1;
-  }
-  KDPoint top = KDPointZero, bottom = KDPointZero;
-  if (p2.y() > p1.y()) {
-    top = p1;
-    bottom = p2;
+  /* Scan the largest gap from the left or top point. The other point is not
+   * drawn. */
+  KDCoordinate deltaX = abs(p2.x() - p1.x());
+  KDCoordinate deltaY = abs(p2.y() - p1.y());
+  if (deltaX >= deltaY) {
+    fillLineRuns(p2.x() > p1.x() ? p1 : p2, p2.x() > p1.x() ? p2 : p1, c, 1);
   } else {
-    top = p2;
-    bottom = p1;
+    fillLineRuns(p2.y() > p1.y() ? p1 : p2, p2.y() > p1.y() ? p2 : p1, c, 1);
   }
-  assert(right.x() >= left.x());
-  assert(bottom.y() >= top.y());
-
-  KDCoordinate deltaX = 2*(right.x() - left.x());
-  KDCoordinate deltaY = 2*(bottom.y() - top.y());
-
-  KDPoint p = KDPointZero, alwaysTranslate = KDPointZero, conditionalTranslate = KDPointZero;
-  KDCoordinate scanLength, error, minusError, plusError;
+}
 
-  if (deltaX >= deltaY) {
-    p = left;
-    scanLength = right.x() - left.x();
-    error = right.x() - left.x();
-    minusError = deltaY;
-    plusError = deltaX;
-    alwaysTranslate = KDPoint(1,0);
-    conditionalTranslate = KDPoint(0, (right.y() >= left.y() ? 1 : -1));
-  } else {
-    p = top;
-    scanLength = bottom.y() - top.y();
-    error = bottom.y() - top.y();
-    minusError = deltaX;
-    plusError = deltaY;
-    alwaysTranslate = KDPoint(0,1);
-    conditionalTranslate = KDPoint((bottom.x() >= top.x() ? 1 : -1), 0);
+void KDContext::drawPolyline(const KDPoint * points, int numberOfPoints, KDColor color, KDCoordinate thickness, const uint8_t * vertexMask, KDColor * workingBuffer) {
+  assert(thickness > 0);
+  assert((vertexMask == nullptr) == (workingBuffer == nullptr));
+  KDCoordinate offset = (thickness - 1)/2;
+  for (int i = 0; i < numberOfPoints; i++) {
+    /* Each segment stops short of its end, which is drawn by the next segment
+     * or as the last point. Thick segments have flat ends, so all vertices are
+     * stamped to fill the corners. */
+    if (i > 0) {
+      fillLineRuns(points[i-1], points[i], color, thickness);
+    }
+    if (i == numberOfPoints - 1 || thickness > 1 || vertexMask != nullptr) {
+      KDRect vertexRect(points[i].x() - offset, points[i].y() - offset, thickness, thickness);
+      if (vertexMask != nullptr) {
+        blendRectWithMask(vertexRect, color, vertexMask, workingBuffer);
+      } else {
+        fillRect(vertexRect, color);
+      }
+    }
   }
+}
 
-  KDCoordinate scanCounter = 0;
-  while (scanCounter++ < scanLength) {
-    setPixel(p, c);
-    p = p.translatedBy(alwaysTranslate);
-    error = error - minusError;
+void KDContext::fillLineRuns(KDPoint start, KDPoint end, KDColor color, KDCoordinate thickness) {
+  /* Bresenham's algorithm, from start to end excluded. Pixels are gathered
+   * into runs along the scan direction, each run being filled at once. */
+  bool scanX = abs(end.x() - start.x()) >= abs(end.y() - start.y());
+  KDCoordinate scanLength = scanX ? abs(end.x() - start.x()) : abs(end.y() - start.y());
+  KDCoordinate slopeLength = scanX ? abs(end.y() - start.y()) : abs(end.x() - start.x());
+  KDCoordinate scanStep = (scanX ? end.x() >= start.x() : end.y() >= start.y()) ? 1 : -1;
+  KDCoordinate slopeStep = (scanX ? end.y() >= start.y() : end.x() >= start.x()) ? 1 : -1;
+  KDCoordinate scan = scanX ? start.x() : start.y();
+  KDCoordinate slope = scanX ? start.y() : start.x();
+  /* Runs are thickened across the scan direction: scale them by the slope so
+   * that the line is thickness pixels wide perpendicularly to itself. A 45°
+   * line would otherwise be thickness/√2 wide. */
+  if (thickness > 1 && scanLength > 0) {
+    float length = sqrtf((float)scanLength * scanLength + (float)slopeLength * slopeLength);
+    thickness = (KDCoordinate)(thickness * length / scanLength + 0.5f);
+  }
+  KDCoordinate offset = (thickness - 1)/2;
+  KDCoordinate runStart = scan;
+  KDCoordinate error = scanLength;
+  for (KDCoordinate i = 0; i < scanLength; i++) {
+    scan += scanStep;
+    error -= 2*slopeLength;
+    if (error <= 0 || i == scanLength - 1) {
+      KDCoordinate runMin = scanStep > 0 ? runStart : scan + 1;
+      KDCoordinate runLength = abs(scan - runStart);
+      if (scanX) {
+        fillRect(KDRect(runMin, slope - offset, runLength, thickness), color);
+      } else {
+        fillRect(KDRect(slope - offset, runMin, thickness, runLength), color);
+      }
+      runStart = scan;
+    }
     if (error <= 0) {
-      p = p.translatedBy(conditionalTranslate);
-      error = error + plusError;
+      slope += slopeStep;
+      error += 2*scanLength;
     }
   }
 }
@@ -61,27 +61,29 @@ void KDContext::fillRectWithPixels(KDRect rect, const KDColor * pixels, KDColor
 
 // Mask's size must be rect.size
 // WorkingBuffer, same deal
-// TODO: should we avoid pullRect by giving a 'memory' working buffer?
 void KDContext::blendRectWithMask(KDRect rect, KDColor color, const uint8_t * mask, KDColor * workingBuffer) {
   KDRect absoluteRect = absoluteFillRect(rect);
+  if (absoluteRect.isEmpty()) {
+    return;
+  }
 
   /* Caution:
    * The absoluteRect may have a SMALLER size than the original rect because it
    * has been clipped. Therefore we cannot assume that the mask can be read as a
    * continuous area. */
 
-  pullRect(absoluteRect, workingBuffer);
   KDCoordinate startingI = m_clippingRect.x() - rect.translatedBy(m_origin).x();
   KDCoordinate startingJ = m_clippingRect.y() - rect.translatedBy(m_origin).y();
   startingI = startingI > 0 ? startingI : 0;
   startingJ = startingJ > 0 ? startingJ : 0;
+  blendAbsoluteRectWithMask(absoluteRect, color, mask + startingI + rect.width()*startingJ, rect.width(), workingBuffer);
+}
+
+void KDContext::blendAbsoluteRectWithMask(KDRect absoluteRect, KDColor color, const uint8_t * mask, KDCoordinate maskWidth, KDColor * workingBuffer) {
+  // TODO: should we avoid pullRect by giving a 'memory' working buffer?
+  pullRect(absoluteRect, workingBuffer);
   for (KDCoordinate j=0; j<absoluteRect.height(); j++) {
-    for (KDCoordinate i=0; i<absoluteRect.width(); i++) {
-      KDColor * currentPixelAdress = workingBuffer + i + absoluteRect.width()*j;
-      const uint8_t * currentMaskAddress = mask + i + startingI + rect.width()*(j + startingJ);
-      *currentPixelAdress = KDColor::blend(*currentPixelAdress, color, *currentMaskAddress);
-      //*currentPixelAdress = KDColorBlend(*currentPixelAdress, color, *currentMaskAddress);
-    }
+    KDColor::blendRow(workingBuffer + absoluteRect.width()*j, color, mask + maskWidth*j, absoluteRect.width());
   }
   pushRect(absoluteRect, workingBuffer);
 }
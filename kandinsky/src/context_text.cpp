@@ -5,6 +5,10 @@
 #include <ion/display.h>
 
 constexpr static int k_tabCharacterWidth = 4;
+/* Consecutive glyphs of a line are composed side by side in a strip of pixels
+ * that is pushed at once: each push sets up a drawing area on the screen,
+ * which costs much more than a few pixels. */
+constexpr static int k_glyphRunPixelCount = 720; // Four glyphs of the large font
 
 KDPoint KDContext::drawString(const char * text, KDPoint p, const KDFont * font, KDColor textColor, KDColor backgroundColor, int maxByteLength) {
   return pushOrPullString(text, p, font, textColor, backgroundColor, maxByteLength, true);
@@ -21,12 +25,21 @@ KDPoint KDContext::pushOrPullString(const char * text, KDPoint p, const KDFont *
   KDSize glyphSize = font->glyphSize();
   KDFont::RenderPalette palette = font->renderPalette(textColor, backgroundColor);
   KDFont::GlyphBuffer glyphBuffer;
+  KDColor glyphRun[k_glyphRunPixelCount];
+  int glyphRunCapacity = k_glyphRunPixelCount / (glyphSize.width() * glyphSize.height());
+  assert(glyphRunCapacity >= 1);
+  int glyphRunLength = 0;
+  KDPoint glyphRunOrigin = position;
 
   UTF8Decoder decoder(text);
   const char * codePointPointer = decoder.stringPosition();
   CodePoint codePoint = decoder.nextCodePoint();
   while (codePoint != UCodePointNull && (maxByteLength < 0 || codePointPointer < text + maxByteLength)) {
     codePointPointer = decoder.stringPosition();
+    if (push && glyphRunLength > 0 && (codePoint == UCodePointLineFeed || codePoint == UCodePointTabulation || glyphRunLength == glyphRunCapacity)) {
+      pushGlyphRun(glyphRunOrigin, glyphSize, glyphRunLength, glyphRunCapacity, glyphRun);
+      glyphRunLength = 0;
+    }
     if (codePoint == UCodePointLineFeed) {
       assert(position.y() < KDCOORDINATE_MAX - glyphSize.height());
       position = KDPoint(0, position.y() + glyphSize.height());
@@ -45,12 +58,18 @@ KDPoint KDContext::pushOrPullString(const char * text, KDPoint p, const KDFont *
       }
       font->colorizeGlyphBuffer(&palette, &glyphBuffer);
       if (push) {
-        // Push the character on the screen
-        fillRectWithPixels(
-            KDRect(position, glyphSize),
-            glyphBuffer.colorBuffer(),
-            glyphBuffer.colorBuffer() // It's OK to trash the content of the color buffer since we'll re-fetch it for the next char anyway
-            );
+        // Add the character to the run of glyphs to push on the screen
+        if (glyphRunLength == 0) {
+          glyphRunOrigin = position;
+        }
+        const KDColor * colorBuffer = glyphBuffer.colorBuffer();
+        KDColor * glyphRunColumn = glyphRun + glyphRunLength * glyphSize.width();
+        for (int j = 0; j < glyphSize.height(); j++) {
+          for (int i = 0; i < glyphSize.width(); i++) {
+            glyphRunColumn[j * glyphRunCapacity * glyphSize.width() + i] = colorBuffer[j * glyphSize.width() + i];
+          }
+        }
+        glyphRunLength++;
       } else {
         // Pull and compare the character from the screen
         assert(result != nullptr);
@@ -74,6 +93,28 @@ KDPoint KDContext::pushOrPullString(const char * text, KDPoint p, const KDFont *
       position = position.translatedBy(KDPoint(glyphSize.width(), 0));
     }
   }
+  if (push && glyphRunLength > 0) {
+    pushGlyphRun(glyphRunOrigin, glyphSize, glyphRunLength, glyphRunCapacity, glyphRun);
+  }
 
   return position;
 }
+
+void KDContext::pushGlyphRun(KDPoint origin, KDSize glyphSize, int numberOfGlyphs, int glyphRunCapacity, KDColor * glyphRun) {
+  /* The lines of the strip are glyphRunCapacity glyphs wide: move them
+   * together if the run is shorter. */
+  int runWidth = numberOfGlyphs * glyphSize.width();
+  if (numberOfGlyphs < glyphRunCapacity) {
+    int stripWidth = glyphRunCapacity * glyphSize.width();
+    for (int j = 1; j < glyphSize.height(); j++) {
+      for (int i = 0; i < runWidth; i++) {
+        glyphRun[j * runWidth + i] = glyphRun[j * stripWidth + i];
+      }
+    }
+  }
+  fillRectWithPixels(
+      KDRect(origin, KDSize(runWidth, glyphSize.height())),
+      glyphRun,
+      glyphRun // It's OK to trash the content of the run since it is composed again for the next one
+      );
+}
@@ -5,6 +5,7 @@ extern "C" {
 #include <ion.h>
 #include <ion/unicode/utf8_decoder.h>
 #include <assert.h>
+#include <string.h>
 
 constexpr static int k_tabCharacterWidth = 4;
 
@@ -47,7 +48,66 @@ void KDFont::accumulateGlyphGrayscalesForCodePoint(CodePoint codePoint, GlyphBuf
   }
 }
 
+/* The glyph cache is fully associative: it is small enough for a linear
+ * search to cost much less than a decompression. The least recently used
+ * glyph is replaced on a miss. */
+class KDFont::GlyphCache {
+public:
+  class Entry {
+  public:
+    const KDFont * m_font; // nullptr for an empty entry
+    uint32_t m_lastUse;
+    GlyphIndex m_index;
+  };
+  Entry m_entries[k_glyphCacheSize];
+  uint8_t m_grayscales[k_glyphCacheSize][k_maxGlyphGrayscaleSize];
+  uint32_t m_clock;
+  GlyphCacheStatistics m_statistics;
+};
+
+KDFont::GlyphCache KDFont::s_glyphCache;
+
+KDFont::GlyphCacheStatistics KDFont::glyphCacheStatistics() {
+  return s_glyphCache.m_statistics;
+}
+
+void KDFont::resetGlyphCache() {
+  for (int i = 0; i < k_glyphCacheSize; i++) {
+    s_glyphCache.m_entries[i].m_font = nullptr;
+  }
+  s_glyphCache.m_statistics = {0, 0};
+}
+
 void KDFont::fetchGrayscaleGlyphAtIndex(KDFont::GlyphIndex index, uint8_t * grayscaleBuffer) const {
+  int grayscaleSize = m_glyphSize.width() * m_glyphSize.height() * k_bitsPerPixel/8;
+  assert(grayscaleSize <= k_maxGlyphGrayscaleSize);
+  uint32_t clock = ++s_glyphCache.m_clock;
+  int leastRecentlyUsed = 0;
+  for (int i = 0; i < k_glyphCacheSize; i++) {
+    GlyphCache::Entry * entry = s_glyphCache.m_entries + i;
+    if (entry->m_font == this && entry->m_index == index) {
+      s_glyphCache.m_statistics.hits++;
+      entry->m_lastUse = clock;
+      memcpy(grayscaleBuffer, s_glyphCache.m_grayscales[i], grayscaleSize);
+      return;
+    }
+    /* Empty entries are used first. Comparing ages rather than clock values
+     * keeps the replacement right when the clock wraps around. */
+    GlyphCache::Entry * candidate = s_glyphCache.m_entries + leastRecentlyUsed;
+    if (candidate->m_font != nullptr && (entry->m_font == nullptr || clock - entry->m_lastUse > clock - candidate->m_lastUse)) {
+      leastRecentlyUsed = i;
+    }
+  }
+  s_glyphCache.m_statistics.misses++;
+  GlyphCache::Entry * entry = s_glyphCache.m_entries + leastRecentlyUsed;
+  entry->m_font = this;
+  entry->m_index = index;
+  entry->m_lastUse = clock;
+  decompressGrayscaleGlyphAtIndex(index, s_glyphCache.m_grayscales[leastRecentlyUsed]);
+  memcpy(grayscaleBuffer, s_glyphCache.m_grayscales[leastRecentlyUsed], grayscaleSize);
+}
+
+void KDFont::decompressGrayscaleGlyphAtIndex(KDFont::GlyphIndex index, uint8_t * grayscaleBuffer) const {
   Ion::decompress(
     compressedGlyphData(index),
     grayscaleBuffer,
@@ -30,15 +30,9 @@ void KDFrameBuffer::pushRectUniform(KDRect rect, KDColor color) {
   // Caution: this code is used very frequently
   // It's worth optimizing!
   KDColor * pixel = pixelAddress(rect.origin());
-  int lineDelta = m_size.width() - rect.width();
   for (KDCoordinate j=0; j<rect.height(); j++) {
-    //KDColor * topLeftPixelAddress = pixelAddress(rect.origin().translatedBy(KDPoint(0,j)));
-    //*pixelAddress(rect.origin().translatedBy(KDPoint(i,j))) = color;
-    for (KDCoordinate i=0; i<rect.width(); i++) {
-      *pixel++ = color;
-      //*pixelAddress(rect.origin().translatedBy(KDPoint(i,j))) = color;
-    }
-    pixel += lineDelta;
+    KDColor::fillRow(pixel, color, rect.width());
+    pixel += m_size.width();
   }
 }
 
@@ -52,3 +46,21 @@ void KDFrameBuffer::pullRect(KDRect rect, KDColor * pixels) {
     line += rect.width();
   }
 }
+
+void KDFrameBuffer::copyRect(KDRect rect, KDPoint destination) {
+  /* Lines are copied in the vertical direction of the move, so that they are
+   * not overwritten before being copied when the rectangles overlap. */
+  bool downwards = destination.y() > rect.y();
+  for (KDCoordinate j=0; j<rect.height(); j++) {
+    KDCoordinate line = downwards ? rect.height() - 1 - j : j;
+    memmove(pixelAddress(destination.translatedBy(KDPoint(0, line))),
+        pixelAddress(rect.origin().translatedBy(KDPoint(0, line))),
+        rect.width()*sizeof(KDColor));
+  }
+}
+
+void KDFrameBuffer::blendRectWithMask(KDRect rect, KDColor color, const uint8_t * mask, KDCoordinate maskWidth) {
+  for (KDCoordinate j=0; j<rect.height(); j++) {
+    KDColor::blendRow(pixelAddress(rect.origin().translatedBy(KDPoint(0, j))), color, mask + maskWidth*j, rect.width());
+  }
+}
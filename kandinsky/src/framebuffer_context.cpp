@@ -17,3 +17,7 @@ void KDFrameBufferContext::pushRectUniform(KDRect rect, KDColor color) {
 void KDFrameBufferContext::pullRect(KDRect rect, KDColor * pixels) {
   m_frameBuffer->pullRect(rect, pixels);
 }
+
+void KDFrameBufferContext::blendAbsoluteRectWithMask(KDRect absoluteRect, KDColor color, const uint8_t * mask, KDCoordinate maskWidth, KDColor * workingBuffer) {
+  m_frameBuffer->blendRectWithMask(absoluteRect, color, mask, maskWidth);
+}
@@ -35,6 +35,16 @@ void KDIonContext::updatePostProcessingEffects() {
   }
 }
 
+bool KDIonContext::copyRect(KDRect rect, KDPoint destination) {
+  /* Inverting colors and gamma correction are applied pixel by pixel, but the
+   * zoomed screen does not show the pixels of the context. */
+  if (zoomEnabled && !zoomInhibit) {
+    return false;
+  }
+  Ion::Display::copyRect(rect, destination);
+  return true;
+}
+
 KDIonContext::KDIonContext() :
 KDContext(KDPointZero,
     KDRect(0, 0, Ion::Display::Width, Ion::Display::Height))
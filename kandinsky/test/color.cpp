@@ -39,3 +39,44 @@ QUIZ_CASE(kandinsky_color_blend) {
     assert_colors_blend_to(color, color, col>>8, color);
   }
 }
+
+constexpr static int k_rowLength = 320;
+static KDColor s_row[k_rowLength];
+static KDColor s_referenceRow[k_rowLength];
+static uint8_t s_alphas[k_rowLength];
+
+static void fill_rows_and_alphas(int seed) {
+  uint32_t value = seed;
+  for (int i = 0; i < k_rowLength; i++) {
+    // Linear congruential generator, to go through various colors and alphas
+    value = value * 1103515245 + 12345;
+    s_row[i] = KDColor::RGB16(value >> 16);
+    s_referenceRow[i] = s_row[i];
+    s_alphas[i] = (i % 7 == 0) ? 0xFF : (i % 11 == 0) ? 0 : value >> 8;
+  }
+}
+
+QUIZ_CASE(kandinsky_color_blend_row) {
+  const KDColor colors[] = {KDColorBlack, KDColorWhite, KDColorRed, KDColor::RGB24(0x123456)};
+  // Various lengths and alignments around the vector width
+  const int offsets[] = {0, 1, 3, 8};
+  const int lengths[] = {0, 1, 7, 8, 9, 17, 200};
+  int seed = 0;
+  for (KDColor color : colors) {
+    for (int offset : offsets) {
+      for (int length : lengths) {
+        fill_rows_and_alphas(seed++);
+        KDColor::blendRow(s_row + offset, color, s_alphas + offset, length);
+        for (int i = 0; i < k_rowLength; i++) {
+          KDColor expected = (i >= offset && i < offset + length) ? KDColor::blend(s_referenceRow[i], color, s_alphas[i]) : s_referenceRow[i];
+          quiz_assert(s_row[i] == expected);
+        }
+        fill_rows_and_alphas(seed++);
+        KDColor::fillRow(s_row + offset, color, length);
+        for (int i = 0; i < k_rowLength; i++) {
+          quiz_assert(s_row[i] == ((i >= offset && i < offset + length) ? color : s_referenceRow[i]));
+        }
+      }
+    }
+  }
+}
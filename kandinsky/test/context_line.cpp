@@ -0,0 +1,180 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <stdlib.h>
+
+constexpr static KDCoordinate k_width = 64;
+constexpr static KDCoordinate k_height = 48;
+
+class UniformPushCountingContext : public KDFrameBufferContext {
+public:
+  UniformPushCountingContext(KDFrameBuffer * frameBuffer) : KDFrameBufferContext(frameBuffer), m_numberOfPushes(0) {}
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRectUniform(rect, color);
+  }
+  int numberOfPushes() const { return m_numberOfPushes; }
+private:
+  int m_numberOfPushes;
+};
+
+static KDColor s_pixels[k_width * k_height];
+static KDColor s_referencePixels[k_width * k_height];
+
+static void draw_line_pixel_by_pixel(KDContext * ctx, KDPoint p1, KDPoint p2, KDColor c) {
+  // Bresenham's algorithm, as drawLine used to plot it
+  KDPoint left = p2.x() > p1.x() ? p1 : p2;
+  KDPoint right = p2.x() > p1.x() ? p2 : p1;
+  KDPoint top = p2.y() > p1.y() ? p1 : p2;
+  KDPoint bottom = p2.y() > p1.y() ? p2 : p1;
+  KDCoordinate deltaX = 2*(right.x() - left.x());
+  KDCoordinate deltaY = 2*(bottom.y() - top.y());
+  KDPoint p = KDPointZero, alwaysTranslate = KDPointZero, conditionalTranslate = KDPointZero;
+  KDCoordinate scanLength, error, minusError, plusError;
+  if (deltaX >= deltaY) {
+    p = left;
+    scanLength = right.x() - left.x();
+    error = scanLength;
+    minusError = deltaY;
+    plusError = deltaX;
+    alwaysTranslate = KDPoint(1, 0);
+    conditionalTranslate = KDPoint(0, right.y() >= left.y() ? 1 : -1);
+  } else {
+    p = top;
+    scanLength = bottom.y() - top.y();
+    error = scanLength;
+    minusError = deltaX;
+    plusError = deltaY;
+    alwaysTranslate = KDPoint(0, 1);
+    conditionalTranslate = KDPoint(bottom.x() >= top.x() ? 1 : -1, 0);
+  }
+  for (KDCoordinate i = 0; i < scanLength; i++) {
+    ctx->setPixel(p, c);
+    p = p.translatedBy(alwaysTranslate);
+    error -= minusError;
+    if (error <= 0) {
+      p = p.translatedBy(conditionalTranslate);
+      error += plusError;
+    }
+  }
+}
+
+static void assert_line_is_drawn_as_pixels(KDPoint p1, KDPoint p2) {
+  KDFrameBuffer frameBuffer(s_pixels, KDSize(k_width, k_height));
+  UniformPushCountingContext context(&frameBuffer);
+  context.fillRect(frameBuffer.bounds(), KDColorWhite);
+  context.drawLine(p1, p2, KDColorBlack);
+
+  KDFrameBuffer referenceFrameBuffer(s_referencePixels, KDSize(k_width, k_height));
+  KDFrameBufferContext referenceContext(&referenceFrameBuffer);
+  referenceContext.fillRect(referenceFrameBuffer.bounds(), KDColorWhite);
+  draw_line_pixel_by_pixel(&referenceContext, p1, p2, KDColorBlack);
+
+  for (int i = 0; i < k_width * k_height; i++) {
+    quiz_assert(s_pixels[i] == s_referencePixels[i]);
+  }
+  // One push for the background, then one per run of pixels
+  int scanLength = abs(p2.x() - p1.x()) >= abs(p2.y() - p1.y()) ? abs(p2.x() - p1.x()) : abs(p2.y() - p1.y());
+  int slopeLength = abs(p2.x() - p1.x()) >= abs(p2.y() - p1.y()) ? abs(p2.y() - p1.y()) : abs(p2.x() - p1.x());
+  int maxNumberOfRuns = slopeLength + 1 < scanLength ? slopeLength + 1 : scanLength;
+  quiz_assert(context.numberOfPushes() <= 1 + maxNumberOfRuns);
+}
+
+QUIZ_CASE(kandinsky_context_draw_line_runs) {
+  assert_line_is_drawn_as_pixels(KDPoint(2, 3), KDPoint(60, 3));
+  assert_line_is_drawn_as_pixels(KDPoint(7, 45), KDPoint(7, 1));
+  assert_line_is_drawn_as_pixels(KDPoint(5, 5), KDPoint(5, 5));
+  assert_line_is_drawn_as_pixels(KDPoint(0, 0), KDPoint(47, 47));
+  assert_line_is_drawn_as_pixels(KDPoint(1, 40), KDPoint(63, 2));
+  assert_line_is_drawn_as_pixels(KDPoint(60, 10), KDPoint(3, 20));
+  assert_line_is_drawn_as_pixels(KDPoint(30, 2), KDPoint(33, 46));
+  assert_line_is_drawn_as_pixels(KDPoint(33, 46), KDPoint(25, 0));
+  // Clipped
+  assert_line_is_drawn_as_pixels(KDPoint(-20, -5), KDPoint(80, 60));
+  // A horizontal line is a single push
+  KDFrameBuffer frameBuffer(s_pixels, KDSize(k_width, k_height));
+  UniformPushCountingContext context(&frameBuffer);
+  context.drawLine(KDPoint(0, 10), KDPoint(50, 10), KDColorBlack);
+  quiz_assert(context.numberOfPushes() == 1);
+}
+
+QUIZ_CASE(kandinsky_context_draw_polyline) {
+  const KDPoint points[] = {KDPoint(4, 4), KDPoint(40, 10), KDPoint(40, 40), KDPoint(10, 30), KDPoint(12, 8)};
+  constexpr int numberOfPoints = sizeof(points)/sizeof(KDPoint);
+
+  // A thin polyline draws its segments and its last point
+  KDFrameBuffer frameBuffer(s_pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  context.fillRect(frameBuffer.bounds(), KDColorWhite);
+  context.drawPolyline(points, numberOfPoints, KDColorBlack);
+  for (int i = 0; i < numberOfPoints; i++) {
+    quiz_assert(s_pixels[points[i].y() * k_width + points[i].x()] == KDColorBlack);
+  }
+  // Segments do not overlap: they stop short of the next vertex
+  int numberOfDrawnPixels = 0;
+  for (int i = 0; i < k_width * k_height; i++) {
+    numberOfDrawnPixels += s_pixels[i] == KDColorBlack;
+  }
+  int expectedNumberOfDrawnPixels = 1;
+  for (int i = 1; i < numberOfPoints; i++) {
+    int deltaX = abs(points[i].x() - points[i-1].x());
+    int deltaY = abs(points[i].y() - points[i-1].y());
+    expectedNumberOfDrawnPixels += deltaX > deltaY ? deltaX : deltaY;
+  }
+  quiz_assert(numberOfDrawnPixels == expectedNumberOfDrawnPixels);
+
+  // A thick polyline covers a pen around each vertex
+  context.fillRect(frameBuffer.bounds(), KDColorWhite);
+  context.drawPolyline(points, numberOfPoints, KDColorBlack, 3);
+  for (int i = 0; i < numberOfPoints; i++) {
+    for (int dx = -1; dx <= 1; dx++) {
+      for (int dy = -1; dy <= 1; dy++) {
+        quiz_assert(s_pixels[(points[i].y() + dy) * k_width + points[i].x() + dx] == KDColorBlack);
+      }
+    }
+  }
+  // A thick vertical segment is one push, plus its squared vertices
+  UniformPushCountingContext countingContext(&frameBuffer);
+  countingContext.fillRect(frameBuffer.bounds(), KDColorWhite);
+  countingContext.drawPolyline(points + 1, 2, KDColorBlack, 3);
+  quiz_assert(countingContext.numberOfPushes() == 1 + 1 + 2);
+  for (int y = 9; y <= 41; y++) {
+    for (int x = 39; x <= 41; x++) {
+      quiz_assert(s_pixels[y * k_width + x] == KDColorBlack);
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_context_draw_thick_polyline) {
+  KDFrameBuffer frameBuffer(s_pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  // A horizontal segment is as thick as asked
+  const KDPoint horizontal[] = {KDPoint(2, 20), KDPoint(60, 20)};
+  context.fillRect(frameBuffer.bounds(), KDColorWhite);
+  context.drawPolyline(horizontal, 2, KDColorBlack, 5);
+  for (int y = 0; y < k_height; y++) {
+    quiz_assert((s_pixels[y * k_width + 30] == KDColorBlack) == (y >= 18 && y <= 22));
+  }
+  /* A diagonal segment is 5 pixels wide perpendicularly to itself, which takes
+   * 5√2 ~ 7 pixels along a column. */
+  const KDPoint diagonal[] = {KDPoint(5, 5), KDPoint(45, 45)};
+  context.fillRect(frameBuffer.bounds(), KDColorWhite);
+  context.drawPolyline(diagonal, 2, KDColorBlack, 5);
+  for (int y = 0; y < k_height; y++) {
+    quiz_assert((s_pixels[y * k_width + 25] == KDColorBlack) == (y >= 22 && y <= 28));
+  }
+  // Vertices can be blended with a mask instead of squared
+  const uint8_t roundMask[] = {
+    0xFF, 0x00, 0xFF,
+    0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF
+  };
+  KDColor workingBuffer[3 * 3];
+  const KDPoint segment[] = {KDPoint(10, 10), KDPoint(30, 10)};
+  context.fillRect(frameBuffer.bounds(), KDColorWhite);
+  context.drawPolyline(segment, 2, KDColorBlack, 3, roundMask, workingBuffer);
+  quiz_assert(s_pixels[10 * k_width + 9] == KDColorBlack);
+  quiz_assert(s_pixels[10 * k_width + 31] == KDColorBlack);
+  quiz_assert(s_pixels[9 * k_width + 31] == KDColorWhite);
+  quiz_assert(s_pixels[11 * k_width + 31] == KDColorWhite);
+  quiz_assert(s_pixels[9 * k_width + 9] == KDColorWhite);
+}
@@ -0,0 +1,64 @@
+#include <quiz.h>
+#include <kandinsky.h>
+#include <string.h>
+
+constexpr static KDCoordinate k_width = 96;
+constexpr static KDCoordinate k_height = 40;
+
+class PushCountingContext : public KDFrameBufferContext {
+public:
+  PushCountingContext(KDFrameBuffer * frameBuffer) : KDFrameBufferContext(frameBuffer), m_numberOfPushes(0) {}
+  void pushRect(KDRect rect, const KDColor * pixels) override {
+    m_numberOfPushes++;
+    KDFrameBufferContext::pushRect(rect, pixels);
+  }
+  int numberOfPushes() const { return m_numberOfPushes; }
+private:
+  int m_numberOfPushes;
+};
+
+static KDColor s_pixels[k_width * k_height];
+static KDColor s_referencePixels[k_width * k_height];
+
+static void assert_string_is_drawn_as_glyphs(const char * text, const KDFont * font, KDRect clippingRect) {
+  KDFrameBuffer frameBuffer(s_pixels, KDSize(k_width, k_height));
+  KDFrameBufferContext context(&frameBuffer);
+  context.setClippingRect(frameBuffer.bounds());
+  context.fillRect(frameBuffer.bounds(), KDColorRed);
+  context.setClippingRect(clippingRect);
+  context.drawString(text, KDPoint(3, 2), font, KDColorBlack, KDColorWhite);
+
+  // Draw the same glyphs one by one
+  KDFrameBuffer referenceFrameBuffer(s_referencePixels, KDSize(k_width, k_height));
+  KDFrameBufferContext referenceContext(&referenceFrameBuffer);
+  referenceContext.setClippingRect(referenceFrameBuffer.bounds());
+  referenceContext.fillRect(referenceFrameBuffer.bounds(), KDColorRed);
+  referenceContext.setClippingRect(clippingRect);
+  KDPoint position(3, 2);
+  for (const char * c = text; *c != 0; c++) {
+    char glyph[2] = {*c, 0};
+    if (*c == '\n') {
+      position = KDPoint(0, position.y() + font->glyphSize().height());
+    } else {
+      position = referenceContext.drawString(glyph, position, font, KDColorBlack, KDColorWhite);
+    }
+  }
+  quiz_assert(memcmp(s_pixels, s_referencePixels, sizeof(s_pixels)) == 0);
+}
+
+QUIZ_CASE(kandinsky_context_draw_string_glyph_runs) {
+  KDRect fullRect(0, 0, k_width, k_height);
+  assert_string_is_drawn_as_glyphs("Hello world", KDFont::LargeFont, fullRect);
+  assert_string_is_drawn_as_glyphs("Hello world", KDFont::SmallFont, fullRect);
+  assert_string_is_drawn_as_glyphs("ab\ncdef\tgh", KDFont::LargeFont, fullRect);
+  assert_string_is_drawn_as_glyphs("abc", KDFont::LargeFont, fullRect);
+  // Runs cut by the clipping rectangle
+  assert_string_is_drawn_as_glyphs("Hello world\nHello world", KDFont::LargeFont, KDRect(17, 5, 50, 22));
+  assert_string_is_drawn_as_glyphs("Hello world\nHello world", KDFont::SmallFont, KDRect(0, 9, 41, 30));
+
+  // Consecutive glyphs are pushed together
+  KDFrameBuffer frameBuffer(s_pixels, KDSize(k_width, k_height));
+  PushCountingContext context(&frameBuffer);
+  context.drawString("12345678", KDPointZero, KDFont::LargeFont);
+  quiz_assert(context.numberOfPushes() == 2);
+}
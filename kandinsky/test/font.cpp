@@ -37,3 +37,50 @@ QUIZ_CASE(kandinsky_font_index_for_code_point) {
     quiz_assert(result == index_for_code_point[i]);
   }
 }
+
+static void fetch_glyph(const KDFont * font, CodePoint c, KDColor * colors) {
+  KDFont::GlyphBuffer glyphBuffer;
+  font->setGlyphGrayscalesForCodePoint(c, &glyphBuffer);
+  KDFont::RenderPalette palette = font->renderPalette(KDColorBlack, KDColorWhite);
+  font->colorizeGlyphBuffer(&palette, &glyphBuffer);
+  int numberOfPixels = font->glyphSize().width() * font->glyphSize().height();
+  for (int i = 0; i < numberOfPixels; i++) {
+    colors[i] = glyphBuffer.colorBuffer()[i];
+  }
+}
+
+QUIZ_CASE(kandinsky_font_glyph_cache) {
+  KDFont::resetGlyphCache();
+  const KDFont * font = KDFont::LargeFont;
+  int numberOfPixels = font->glyphSize().width() * font->glyphSize().height();
+  KDColor first[200];
+  KDColor second[200];
+  assert(numberOfPixels <= 200);
+  fetch_glyph(font, 'a', first);
+  quiz_assert(KDFont::glyphCacheStatistics().misses == 1);
+  fetch_glyph(font, 'a', second);
+  quiz_assert(KDFont::glyphCacheStatistics().hits == 1);
+  for (int i = 0; i < numberOfPixels; i++) {
+    quiz_assert(first[i] == second[i]);
+  }
+
+  // The same glyph index in another font is another entry
+  fetch_glyph(KDFont::SmallFont, 'a', second);
+  quiz_assert(KDFont::glyphCacheStatistics().misses == 2);
+
+  // Filling the cache evicts the least recently used glyph
+  for (uint32_t c = '0'; c <= '9'; c++) {
+    fetch_glyph(font, c, second);
+  }
+  for (uint32_t c = 'A'; c <= 'Z'; c++) {
+    fetch_glyph(font, c, second);
+  }
+  uint32_t misses = KDFont::glyphCacheStatistics().misses;
+  fetch_glyph(font, 'Z', second);
+  quiz_assert(KDFont::glyphCacheStatistics().misses == misses);
+  fetch_glyph(font, 'a', second);
+  quiz_assert(KDFont::glyphCacheStatistics().misses == misses + 1);
+  for (int i = 0; i < numberOfPixels; i++) {
+    quiz_assert(first[i] == second[i]);
+  }
+}
@@ -0,0 +1,40 @@
+#include <quiz.h>
+#include <kandinsky.h>
+
+constexpr static KDCoordinate k_width = 8;
+constexpr static KDCoordinate k_height = 6;
+
+static KDColor colorAt(KDCoordinate x, KDCoordinate y) {
+  return KDColor::RGB16(x + k_width * y);
+}
+
+static void fill_frame_buffer(KDColor * pixels) {
+  for (KDCoordinate y = 0; y < k_height; y++) {
+    for (KDCoordinate x = 0; x < k_width; x++) {
+      pixels[x + k_width * y] = colorAt(x, y);
+    }
+  }
+}
+
+static void assert_rect_is_copied(KDRect rect, KDPoint destination) {
+  KDColor pixels[k_width * k_height];
+  fill_frame_buffer(pixels);
+  KDFrameBuffer frameBuffer(pixels, KDSize(k_width, k_height));
+  frameBuffer.copyRect(rect, destination);
+  KDRect destinationRect = KDRect(destination, rect.size());
+  for (KDCoordinate y = 0; y < k_height; y++) {
+    for (KDCoordinate x = 0; x < k_width; x++) {
+      KDColor expected = destinationRect.contains(KDPoint(x, y)) ? colorAt(x - destination.x() + rect.x(), y - destination.y() + rect.y()) : colorAt(x, y);
+      quiz_assert(pixels[x + k_width * y] == expected);
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_framebuffer_copy_rect) {
+  assert_rect_is_copied(KDRect(0, 0, 3, 2), KDPoint(5, 4));
+  // Overlapping rectangles, as when scrolling
+  assert_rect_is_copied(KDRect(0, 1, k_width, k_height - 1), KDPoint(0, 0));
+  assert_rect_is_copied(KDRect(0, 0, k_width, k_height - 2), KDPoint(0, 2));
+  assert_rect_is_copied(KDRect(1, 1, 5, 3), KDPoint(2, 2));
+  assert_rect_is_copied(KDRect(2, 2, 5, 3), KDPoint(1, 1));
+}
@@ -0,0 +1,56 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include <poincare/approximation_program.h>
+#include <apps/shared/global_context.h>
+#include "../test/helper.h"
+
+using namespace Poincare;
+
+constexpr static int k_numberOfValues = 320;
+static float s_x[k_numberOfValues];
+static float s_results[k_numberOfValues];
+
+static void time_approximations(const char * expression) {
+  // As many values as a graph of the screen width, a hundred times
+  constexpr int numberOfRepetitions = 100;
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  e = e.simplify(ExpressionNode::ReductionContext(&globalContext, Real, Radian, Metric, SystemForApproximation));
+  ApproximationProgram program;
+  quiz_assert(program.compile(e, "x", &globalContext, Real, Radian));
+  for (int i = 0; i < k_numberOfValues; i++) {
+    s_x[i] = -10.0f + 20.0f * i / k_numberOfValues;
+  }
+  quiz_print(expression);
+
+  // The tree
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int j = 0; j < numberOfRepetitions; j++) {
+    for (int i = 0; i < k_numberOfValues; i++) {
+      s_results[i] = e.approximateWithValueForSymbol<float>("x", s_x[i], &globalContext, Real, Radian);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+
+  // The program, one value at a time
+  startTime = quiz_stopwatch_start();
+  for (int j = 0; j < numberOfRepetitions; j++) {
+    for (int i = 0; i < k_numberOfValues; i++) {
+      s_results[i] = program.approximateWithValueForSymbol(s_x[i]);
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+
+  // The program, by batches
+  startTime = quiz_stopwatch_start();
+  for (int j = 0; j < numberOfRepetitions; j++) {
+    program.approximateWithValuesForSymbol(s_x, s_results, k_numberOfValues);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_approximation_program_benchmark) {
+  time_approximations("3x^2-2x+1+sin(x)/x");
+  time_approximations("ℯ^(-x^2/2)/√(2π)");
+  time_approximations("tan(x)+√(x)");
+}
@@ -0,0 +1,92 @@
+#ifndef POINCARE_APPROXIMATION_PROGRAM_H
+#define POINCARE_APPROXIMATION_PROGRAM_H
+
+#include <poincare/approximation_helper.h>
+#include <poincare/expression.h>
+#include <complex>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* An ApproximationProgram is a reduced expression of one variable compiled
+ * into a flat stack bytecode. Graphs, values tables and root or extremum
+ * searches approximate the same expression for thousands of values of the
+ * variable: running the program avoids the virtual approximate calls, the
+ * lookup of the variable in a VariableContext and the Evaluation of each
+ * operand.
+ * Sub-expressions that do not depend on the variable are approximated once at
+ * compile time. The program first runs on real numbers, with plain float or
+ * double operations mirroring the real cases of the nodes. The values for which
+ * an operation leaves its real domain, or gives a result small enough to be
+ * neglected, are approximated again on complex numbers by the same methods as
+ * the nodes. The program and Expression::approximateWithValueForSymbol thus
+ * agree up to the rounding of the real and complex std functions.
+ * Expressions containing other symbols, functions, random nodes, or nodes the
+ * program does not know (matrices, units, integrals...) cannot be compiled:
+ * the caller then approximates the tree itself. */
+
+class ApproximationProgram {
+public:
+  ApproximationProgram() { reset(); }
+  bool compile(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  void reset();
+  bool isCompiled() const { return m_numberOfInstructions > 0; }
+  template<typename T> T approximateWithValueForSymbol(T x) const;
+  /* Approximate the expression for an array of values of the variable. The
+   * values are processed by batches, running each instruction on a whole
+   * batch before the next one. */
+  template<typename T> void approximateWithValuesForSymbol(const T * x, T * results, int numberOfValues) const;
+
+private:
+  constexpr static int k_maxNumberOfInstructions = 32;
+  constexpr static int k_maxNumberOfConstants = 12;
+  constexpr static int k_maxStackDepth = 8;
+  constexpr static int k_batchSize = 16;
+  constexpr static uint8_t k_noArgument = UINT8_MAX;
+
+  /* Instructions are named after the node they compute. They pop their
+   * operands and push their result. A Float instruction pushes the constant
+   * of index argument, a Symbol instruction pushes the value of the variable.
+   * The argument of a Power instruction in real format is the index of the
+   * constant p+q𝐢 when the index is a rational p/q, to look for a real root. */
+  class Instruction {
+  public:
+    ExpressionNode::Type type;
+    uint8_t argument;
+    uint8_t numberOfOperands;
+  };
+
+  bool compileExpression(const Expression e, const char * symbol, Context * context, int * stackDepth);
+  bool compileConstant(const Expression e, Context * context, int * stackDepth);
+  bool addInstruction(ExpressionNode::Type type, uint8_t argument, int numberOfOperands, int * stackDepth);
+  bool addConstant(std::complex<double> c, uint8_t * index);
+  uint8_t rationalIndexConstant(const Expression index);
+
+  template<typename T, int N> void approximateBatch(const T * x, T * results) const;
+  /* Set fallsBack for the values that leave the real domain of an
+   * instruction, their results are then meaningless. */
+  template<typename T, int N> void approximateRealBatch(const T * x, T * results, bool fallsBack[N]) const;
+  template<typename T, int N> void approximateComplexBatch(const T * x, T * results) const;
+  /* Compute the instruction on real operands, writing the result in place of
+   * the first operand. Values outside of the real domain are set to NAN. */
+  template<typename T, int N> void computeRealInstruction(const Instruction & instruction, T operands[][N], const T * x) const;
+  // Compute the instruction on the values of index start to end - 1
+  template<typename T, int N> void computeInstruction(const Instruction & instruction, const std::complex<T> operands[][N], const T * x, std::complex<T> results[N], int start, int end) const;
+  template<typename T> std::complex<T> computePower(std::complex<T> c, std::complex<T> d, uint8_t rationalIndex) const;
+  template<typename T> std::complex<T> computeNthRoot(std::complex<T> base, std::complex<T> index) const;
+  template<typename T> static ApproximationHelper::ComplexCompute<T> FunctionCompute(ExpressionNode::Type type);
+
+  Instruction m_instructions[k_maxNumberOfInstructions];
+  std::complex<double> m_constants[k_maxNumberOfConstants];
+  uint8_t m_numberOfInstructions;
+  uint8_t m_numberOfConstants;
+  Preferences::ComplexFormat m_complexFormat;
+  Preferences::AngleUnit m_angleUnit;
+  // Approximating the constants built complex numbers in real format
+  bool m_constantsEncounteredComplex;
+  bool m_constantsAreReal;
+};
+
+}
+
+#endif
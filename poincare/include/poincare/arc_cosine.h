@@ -8,6 +8,7 @@
 namespace Poincare {
 
 class ArcCosineNode final : public ExpressionNode {
+  friend class ApproximationProgram;
 public:
 
   // TreeNode
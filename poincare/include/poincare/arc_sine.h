@@ -8,6 +8,7 @@
 namespace Poincare {
 
 class ArcSineNode final : public ExpressionNode {
+  friend class ApproximationProgram;
 public:
 
   // TreeNode
@@ -8,6 +8,7 @@
 namespace Poincare {
 
 class ArcTangentNode final : public ExpressionNode {
+  friend class ApproximationProgram;
 public:
 
   // TreeNode
@@ -21,17 +21,18 @@ public:
    * Before calling PrimeFactorization, we initiate two tables of Integers
    * (outputFactors & outputCoefficients) of length k_maxNumberOfPrimeFactors = 32.
    * As explained in 'integer.h', we guarantee the existence of only 16 Integers
-   * simultaneously. However, primeFactors are capped by
-   * k_biggestPrimeFactor*k_biggestPrimeFactor and they thus benefit from the
-   * small integer optimization. Thereby, the tables will not allocate any
-   * Integer on the static Integer table that limit the number of Integer
-   * simultaneously alive. */
+   * simultaneously. However, primeFactors are capped by 2^64 and at most 4
+   * of them exceed k_biggestPrimeFactor*k_biggestPrimeFactor: the others
+   * benefit from the small integer optimization. Thereby, the tables will
+   * barely allocate any Integer on the static Integer table that limit the
+   * number of Integer simultaneously alive. */
   static int PrimeFactorization(const Integer & i, Integer outputFactors[], Integer outputCoefficients[], int outputLength);
   constexpr static int k_numberOfPrimeFactors = 1000;
   constexpr static int k_maxNumberOfPrimeFactors = 32;
 private:
   /* When decomposing an integer into primes factors, we look for its prime
-   * factors among integer from 2 to 10000. */
+   * factors among integer from 2 to 10000. The remaining factor is then
+   * factorized with the Pollard-rho algorithm if it fits a uint64_t. */
   constexpr static int k_biggestPrimeFactor = 10000;
 };
 
@@ -11,6 +11,7 @@ class Division;
 class DivisionNode /*final*/ : public ExpressionNode {
 template<int T>
   friend class LogarithmNode;
+  friend class ApproximationProgram;
 public:
 
   // TreeNode
@@ -20,6 +20,7 @@ class Symbol;
 class Expression : public TreeHandle {
   friend class AbsoluteValue;
   friend class Addition;
+  friend class ApproximationProgram;
   friend class ArcCosine;
   friend class ArcSine;
   friend class ArcTangent;
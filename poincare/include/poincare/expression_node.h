@@ -272,6 +272,15 @@ public:
    * reimplement simplificationOrderGreaterType. */
   virtual int simplificationOrderGreaterType(const ExpressionNode * e, bool ascending, bool canBeInterrupted, bool ignoreParentheses) const { return ascending ? -1 : 1; }
   virtual int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool canBeInterrupted, bool ignoreParentheses) const;
+  /* The structural hash is a summary of the subtree, cached in the node until
+   * the subtree is modified. It is consistent with the SimplificationOrder
+   * (without ignoring parentheses): two expressions of order 0 have the same
+   * hash. Different hashes thus prove that two expressions are not identical.
+   * Nodes whose order can be 0 with expressions of another type (power to 1,
+   * single-operand addition or multiplication) or that ignore some of their
+   * children when ordering reimplement computeStructuralHash. */
+  uint8_t structuralHash() const;
+  virtual uint32_t computeStructuralHash() const;
 
   /* Layout Helper */
   virtual Layout createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const = 0;
@@ -319,6 +328,9 @@ public:
   virtual void setChildrenInPlace(Expression other);
 
 protected:
+  static uint32_t CombineStructuralHash(uint32_t hash, uint32_t value) { return (hash ^ value) * 16777619u; }
+  static uint32_t ShallowStructuralHash(Type type) { return CombineStructuralHash(2166136261u, static_cast<uint32_t>(type)); }
+
   /* Hierarchy */
   ExpressionNode * parent() const override { return static_cast<ExpressionNode *>(TreeNode::parent()); }
   Direct<ExpressionNode> children() const { return Direct<ExpressionNode>(this); }
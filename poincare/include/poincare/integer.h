@@ -183,9 +183,6 @@ private:
   static int8_t ucmp(const Integer & a, const Integer & b); // -1, 0, or 1
   static Integer usum(const Integer & a, const Integer & b, bool subtract, bool oneDigitOverflow = false);
   static IntegerDivision udiv(const Integer & a, const Integer & b);
-  Integer multiplyByPowerOf2(uint8_t pow) const;
-  Integer divideByPowerOf2(uint8_t pow) const;
-  Integer multiplyByPowerOfBase(uint8_t pow) const;
 
   // HalfDigits
   uint16_t numberOfHalfDigits() const {
@@ -7,6 +7,7 @@
 namespace Poincare {
 
 class NaperianLogarithmNode final : public ExpressionNode  {
+  friend class ApproximationProgram;
 public:
   // TreeNode
   size_t size() const override { return sizeof(NaperianLogarithmNode); }
@@ -58,6 +58,7 @@ private:
   LayoutShape rightLayoutShape() const override { return LayoutShape::RightOfPower; }
   int simplificationOrderGreaterType(const ExpressionNode * e, bool ascending, bool canBeInterrupted, bool ignoreParentheses) const override;
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool canBeInterrupted, bool ignoreParentheses) const override;
+  uint32_t computeStructuralHash() const override;
   Expression denominator(ReductionContext reductionContext) const override;
   bool derivate(ReductionContext reductionContext, Expression symbol, Expression symbolValue) override;
   // Evaluation
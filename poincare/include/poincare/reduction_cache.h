@@ -0,0 +1,81 @@
+#ifndef POINCARE_REDUCTION_CACHE_H
+#define POINCARE_REDUCTION_CACHE_H
+
+#include <poincare/expression.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* The reduction cache memoizes the last reductions of root expressions. Apps
+ * often reduce the same expression again (history items, ans, values of the
+ * same function...).
+ * Entries store a copy of the input tree and of the reduced tree outside of
+ * the TreePool. The input is matched node per node, regardless of the
+ * identifiers, and the reduced tree is copied back into the pool on a hit.
+ * The reduction of symbols, functions and sequences depends on the content of
+ * the context, and random nodes must be drawn again: expressions containing
+ * them are never memoized. */
+
+class ReductionCache final {
+public:
+  static ReductionCache * sharedCache();
+
+  ReductionCache();
+
+  /* Return a copy of the memoized reduction of e or an uninitialized
+   * expression. On a miss, a copy of e is kept and entryStamp is set to
+   * identify it when storing its reduction, or to 0 if e cannot be memoized. */
+  Expression reducedExpression(const Expression e, ExpressionNode::ReductionContext reductionContext, uint16_t * entryStamp);
+  void storeReducedExpression(uint16_t entryStamp, const Expression reducedExpression);
+
+  void setEnabled(bool enabled) { m_enabled = enabled; }
+  bool isEnabled() const { return m_enabled; }
+  void clear();
+
+  int numberOfHits() const { return m_numberOfHits; }
+  int numberOfMisses() const { return m_numberOfMisses; }
+
+  static bool TreesHaveSameContent(const Expression e1, const Expression e2);
+
+private:
+  constexpr static int k_numberOfEntries = 4;
+  // An entry holds both trees, which are about 15 nodes each in usual inputs
+  constexpr static int k_entryBufferSize = 32*sizeof(TreeNode);
+  constexpr static uint16_t k_emptyStamp = 0;
+
+  class Entry {
+  public:
+    Entry() : m_stamp(k_emptyStamp), m_isComplete(false) {}
+    uint16_t stamp() const { return m_stamp; }
+    bool isComplete() const { return m_isComplete; }
+    bool matches(const Expression e, uint32_t reductionContextKey) const;
+    bool setInput(uint16_t stamp, const Expression e, uint32_t reductionContextKey);
+    bool setOutput(const Expression e);
+    Expression output() const;
+    void invalidate() { m_stamp = k_emptyStamp; m_isComplete = false; }
+  private:
+    size_t outputOffset() const;
+    const TreeNode * input() const { return reinterpret_cast<const TreeNode *>(m_buffer); }
+    uint16_t m_stamp;
+    bool m_isComplete;
+    uint16_t m_inputSize;
+    uint16_t m_outputSize;
+    uint32_t m_reductionContextKey;
+    AlignedNodeBuffer m_buffer[k_entryBufferSize/ByteAlignment];
+  };
+
+  static bool IsMemoizable(const Expression e);
+  static uint32_t ReductionContextKey(ExpressionNode::ReductionContext reductionContext);
+  static bool TreesHaveSameContent(const TreeNode * n1, const TreeNode * n2, size_t size);
+
+  Entry m_entries[k_numberOfEntries];
+  int m_nextEntryIndex;
+  uint16_t m_lastStamp;
+  bool m_enabled;
+  int m_numberOfHits;
+  int m_numberOfMisses;
+};
+
+}
+
+#endif
@@ -8,6 +8,7 @@
 namespace Poincare {
 
 class SquareRootNode /*final*/ : public ExpressionNode  {
+  friend class ApproximationProgram;
 public:
   // ExpressionNode
   Sign sign(Context * context) const override { return childAtIndex(0)->sign(context) == Sign::Positive ? Sign::Positive : Sign::Unknown ; }
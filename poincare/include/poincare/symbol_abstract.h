@@ -30,6 +30,7 @@ public:
 
   // ExpressionNode
   int simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool canBeInterrupted, bool ignoreParentheses) const override;
+  uint32_t computeStructuralHash() const override;
 
   // Property
   Sign sign(Context * context) const override;
@@ -7,6 +7,7 @@
 namespace Poincare {
 
 class TangentNode final : public ExpressionNode {
+  friend class ApproximationProgram;
 public:
 
   // TreeNode
@@ -41,6 +41,7 @@ class TreeNode {
 public:
   static constexpr uint16_t NoNodeIdentifier = -2;
   static constexpr uint16_t OverflowIdentifier = TreeNode::NoNodeIdentifier + 1; // Used for Integer
+  static constexpr uint8_t NoStructuralHash = 0;
 
   // Constructor and destructor
   virtual ~TreeNode() {}
@@ -62,6 +63,18 @@ public:
   void release(int currentNumberOfChildren);
   void rename(uint16_t identifier, bool unregisterPreviousIdentifier);
 
+  /* Structural hash
+   * Subclasses may cache a hash of their subtree in the pool. Any operation
+   * that changes the children of a node has to invalidate the cached hashes of
+   * this node and of its ancestors. */
+  uint8_t cachedStructuralHash() const;
+  void setCachedStructuralHash(uint8_t hash) const;
+  void invalidateStructuralHash();
+
+  /* Compare the data of two nodes, ignoring the identifiers and the reference
+   * counter which depend on the node life in the pool. */
+  bool hasSameContentAs(const TreeNode * node) const;
+
   // Hierarchy
   virtual TreeNode * parent() const;
   virtual TreeNode * root();
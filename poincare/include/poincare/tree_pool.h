@@ -22,7 +22,7 @@ public:
   static TreePool * sharedPool() { assert(SharedStaticPool != nullptr); return SharedStaticPool; }
   static void RegisterPool(TreePool * pool) {  assert(SharedStaticPool == nullptr); SharedStaticPool = pool; }
 
-  TreePool() : m_cursor(buffer()) {}
+  TreePool() : m_cursor(buffer()), m_structuralHashes() {}
 
   // Node
   TreeNode * node(uint16_t identifier) const {
@@ -50,6 +50,16 @@ public:
 #endif
   int numberOfNodes() const;
 
+  // Structural hashes of the nodes, by identifier
+  uint8_t structuralHash(uint16_t identifier) const {
+    assert(TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes);
+    return m_structuralHashes[identifier];
+  }
+  void setStructuralHash(uint16_t identifier, uint8_t hash) {
+    assert(TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes);
+    m_structuralHashes[identifier] = hash;
+  }
+
 private:
   constexpr static int BufferSize = 16384;
   constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode);
@@ -149,6 +159,10 @@ private:
   char * m_cursor;
   IdentifierStack m_identifiers;
   uint16_t m_nodeForIdentifierOffset[MaxNumberOfNodes];
+  /* The hashes are kept out of the nodes: an extra byte in TreeNode would take
+   * the padding that follows its reference counter, where nodes such as
+   * RationalNode store their first members. */
+  uint8_t m_structuralHashes[MaxNumberOfNodes];
   static_assert(k_maxNodeOffset < UINT16_MAX && sizeof(m_nodeForIdentifierOffset[0]) == sizeof(uint16_t),
         "The tree pool node offsets in m_nodeForIdentifierOffset cannot be written with the chosen data size (uint16_t)");
 };
@@ -21,6 +21,7 @@ public:
   static constexpr float k_minimalRangeLength = 1e-4f;
 
   typedef float (*ValueAtAbscissa)(float abscissa, Context * context, const void * auxiliary);
+  typedef void (*ValuesAtAbscissae)(const float * abscissae, float * values, int numberOfValues, Context * context, const void * auxiliary);
 
   /* Find the most suitable window to display the function's points of
    * interest. Return false if the X range was given a default value because
@@ -33,6 +34,8 @@ public:
    * between X and Y. Usually used to find the most fitting orthonormal range. */
   static void RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, float * xMin, float * xMax, float * yMin, float * yMax, Context * context, const void * auxiliary);
   static void FullRange(ValueAtAbscissa evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary);
+  // Idem, with an evaluation of several abscissae at once
+  static void FullRange(ValuesAtAbscissae evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary);
 
   /* Find the bounding box of the given ranges. */
   static void CombineRanges(int length, const float * mins, const float * maxs, float * minRes, float * maxRes);
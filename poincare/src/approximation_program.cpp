@@ -0,0 +1,578 @@
+#include <poincare/approximation_program.h>
+#include <poincare/absolute_value.h>
+#include <poincare/addition.h>
+#include <poincare/arc_cosine.h>
+#include <poincare/arc_sine.h>
+#include <poincare/arc_tangent.h>
+#include <poincare/complex.h>
+#include <poincare/cosine.h>
+#include <poincare/division.h>
+#include <poincare/logarithm.h>
+#include <poincare/multiplication.h>
+#include <poincare/naperian_logarithm.h>
+#include <poincare/opposite.h>
+#include <poincare/power.h>
+#include <poincare/rational.h>
+#include <poincare/sine.h>
+#include <poincare/square_root.h>
+#include <poincare/subtraction.h>
+#include <poincare/symbol.h>
+#include <poincare/tangent.h>
+#include <poincare/trigonometry.h>
+#include <string.h>
+#include <cmath>
+
+namespace Poincare {
+
+/* Mimic the construction of a Complex node, which flags non-real results and
+ * drops the sign of zeros. */
+template<typename T>
+static std::complex<T> ComplexResult(std::complex<T> c) {
+  if (!std::isnan(c.imag()) && c.imag() != (T)0.0) {
+    Expression::SetEncounteredComplex(true);
+  }
+  if (c.real() == -0) {
+    c.real(0);
+  }
+  if (c.imag() == -0) {
+    c.imag(0);
+  }
+  return c;
+}
+
+template<typename T>
+static bool IsUndefined(std::complex<T> c) {
+  return std::isnan(c.real()) && std::isnan(c.imag());
+}
+
+static bool DependsOnSymbols(const Expression e) {
+  return e.hasExpression([](const Expression e, const void * context) {
+        ExpressionNode::Type types[] = {ExpressionNode::Type::Symbol, ExpressionNode::Type::Function, ExpressionNode::Type::Sequence};
+        return e.isOfType(types, 3);
+      }, nullptr);
+}
+
+bool ApproximationProgram::compile(const Expression e, const char * symbol, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  reset();
+  if (e.isUninitialized() || e.hasExpression([](const Expression e, const void * context) { return e.isRandom(); }, nullptr)) {
+    return false;
+  }
+  m_complexFormat = complexFormat;
+  m_angleUnit = angleUnit;
+  int stackDepth = 0;
+  if (!compileExpression(e, symbol, context, &stackDepth)) {
+    reset();
+    return false;
+  }
+  assert(stackDepth == 1);
+  return true;
+}
+
+void ApproximationProgram::reset() {
+  m_numberOfInstructions = 0;
+  m_numberOfConstants = 0;
+  m_complexFormat = Preferences::ComplexFormat::Real;
+  m_angleUnit = Preferences::AngleUnit::Radian;
+  m_constantsEncounteredComplex = false;
+  m_constantsAreReal = true;
+}
+
+template<typename T>
+T ApproximationProgram::approximateWithValueForSymbol(T x) const {
+  T result;
+  approximateBatch<T, 1>(&x, &result);
+  return result;
+}
+
+template<typename T>
+void ApproximationProgram::approximateWithValuesForSymbol(const T * x, T * results, int numberOfValues) const {
+  int i = 0;
+  for (; i + k_batchSize <= numberOfValues; i += k_batchSize) {
+    approximateBatch<T, k_batchSize>(x + i, results + i);
+  }
+  for (; i < numberOfValues; i++) {
+    results[i] = approximateWithValueForSymbol(x[i]);
+  }
+}
+
+template<typename T, int N>
+void ApproximationProgram::approximateBatch(const T * x, T * results) const {
+  assert(isCompiled());
+  bool fallsBack[N];
+  if (m_constantsAreReal && !(m_complexFormat == Preferences::ComplexFormat::Real && m_constantsEncounteredComplex)) {
+    approximateRealBatch<T, N>(x, results, fallsBack);
+  } else {
+    for (int j = 0; j < N; j++) {
+      fallsBack[j] = true;
+    }
+  }
+  for (int j = 0; j < N; j++) {
+    if (fallsBack[j]) {
+      approximateComplexBatch<T, 1>(x + j, results + j);
+    }
+  }
+}
+
+template<typename T, int N>
+void ApproximationProgram::approximateRealBatch(const T * x, T * results, bool fallsBack[N]) const {
+  /* Each instruction is run on the N values before the next one: a slot of the
+   * stack holds the N operands. */
+  T stack[k_maxStackDepth][N];
+  for (int j = 0; j < N; j++) {
+    fallsBack[j] = false;
+  }
+  int stackDepth = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    const Instruction & instruction = m_instructions[i];
+    stackDepth -= instruction.numberOfOperands;
+    computeRealInstruction<T, N>(instruction, stack + stackDepth, x);
+    for (int j = 0; j < N; j++) {
+      T result = stack[stackDepth][j];
+      /* Undefined and infinite values are left to the complex computation,
+       * which knows how the nodes handle them. */
+      fallsBack[j] = fallsBack[j] || !std::isfinite(result);
+      // Drop the sign of zeros as Complex nodes do
+      if (result == (T)0.0) {
+        stack[stackDepth][j] = (T)0.0;
+      }
+    }
+    stackDepth++;
+  }
+  assert(stackDepth == 1);
+  for (int j = 0; j < N; j++) {
+    results[j] = stack[0][j];
+  }
+}
+
+template<typename T, int N>
+void ApproximationProgram::approximateComplexBatch(const T * x, T * results) const {
+  std::complex<T> stack[k_maxStackDepth][N];
+  std::complex<T> instructionResults[N];
+  bool encounteredComplex[N];
+  for (int j = 0; j < N; j++) {
+    encounteredComplex[j] = m_constantsEncounteredComplex;
+  }
+  int stackDepth = 0;
+  for (int i = 0; i < m_numberOfInstructions; i++) {
+    const Instruction & instruction = m_instructions[i];
+    stackDepth -= instruction.numberOfOperands;
+    // Node computations flag complex results in Expression
+    Expression::SetEncounteredComplex(false);
+    computeInstruction<T, N>(instruction, stack + stackDepth, x, instructionResults, 0, N);
+    if (Expression::EncounteredComplex()) {
+      /* Rarely, some values were flagged: run the instruction again one value
+       * at a time to know which ones. */
+      for (int j = 0; j < N; j++) {
+        Expression::SetEncounteredComplex(false);
+        computeInstruction<T, N>(instruction, stack + stackDepth, x, instructionResults, j, j + 1);
+        encounteredComplex[j] = encounteredComplex[j] || Expression::EncounteredComplex();
+      }
+    }
+    for (int j = 0; j < N; j++) {
+      stack[stackDepth][j] = instructionResults[j];
+    }
+    stackDepth++;
+  }
+  assert(stackDepth == 1);
+  for (int j = 0; j < N; j++) {
+    // Follow Expression::approximateToScalar
+    bool isUnreal = m_complexFormat == Preferences::ComplexFormat::Real && encounteredComplex[j];
+    results[j] = !isUnreal && stack[0][j].imag() == (T)0.0 ? stack[0][j].real() : NAN;
+  }
+}
+
+template<typename T, int N>
+void ApproximationProgram::computeRealInstruction(const Instruction & instruction, T operands[][N], const T * x) const {
+  /* Mirror the cases of the node computations that take and return reals.
+   * Results small enough to be neglected by
+   * ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable are left to
+   * the complex computation. */
+  const T neglectThreshold = (T)10.0 * ApproximationHelper::Epsilon<T>();
+  T * results = operands[0];
+  switch (instruction.type) {
+    case ExpressionNode::Type::Float:
+    {
+      T constant = static_cast<T>(m_constants[instruction.argument].real());
+      for (int j = 0; j < N; j++) {
+        results[j] = constant;
+      }
+      return;
+    }
+    case ExpressionNode::Type::Symbol:
+      for (int j = 0; j < N; j++) {
+        results[j] = x[j];
+      }
+      return;
+    case ExpressionNode::Type::Addition:
+      for (int k = 1; k < instruction.numberOfOperands; k++) {
+        for (int j = 0; j < N; j++) {
+          results[j] += operands[k][j];
+        }
+      }
+      return;
+    case ExpressionNode::Type::Multiplication:
+      for (int k = 1; k < instruction.numberOfOperands; k++) {
+        for (int j = 0; j < N; j++) {
+          results[j] *= operands[k][j];
+        }
+      }
+      return;
+    case ExpressionNode::Type::Subtraction:
+      for (int j = 0; j < N; j++) {
+        results[j] -= operands[1][j];
+      }
+      return;
+    case ExpressionNode::Type::Opposite:
+      for (int j = 0; j < N; j++) {
+        results[j] = -results[j];
+      }
+      return;
+    case ExpressionNode::Type::Division:
+      // A null divisor gives a non-finite value, as undefined by DivisionNode
+      for (int j = 0; j < N; j++) {
+        results[j] /= operands[1][j];
+      }
+      return;
+    case ExpressionNode::Type::Power:
+    {
+      // Follow computePower and PowerNode::compute
+      bool hasOddRationalIndex = false;
+      bool negatesNegativeBases = false;
+      T rationalIndex = NAN;
+      if (instruction.argument != k_noArgument) {
+        T p = static_cast<T>(m_constants[instruction.argument].real());
+        T q = static_cast<T>(m_constants[instruction.argument].imag());
+        hasOddRationalIndex = std::pow((T)-1.0, q) < (T)0.0;
+        negatesNegativeBases = std::pow((T)-1.0, p) < (T)0.0;
+        rationalIndex = p/q;
+      }
+      for (int j = 0; j < N; j++) {
+        T c = results[j];
+        T d = operands[1][j];
+        if (hasOddRationalIndex && c != (T)0.0) {
+          T absCPowD = std::pow(std::fabs(c), rationalIndex);
+          results[j] = c < (T)0.0 && negatesNegativeBases ? -absCPowD : absCPowD;
+        } else if (c != (T)0.0 && (c > (T)0.0 || std::round(d) == d)) {
+          results[j] = std::pow(c, d);
+        } else {
+          results[j] = NAN;
+        }
+      }
+      return;
+    }
+    case ExpressionNode::Type::NthRoot:
+      // Follow computeNthRoot and PowerNode::compute
+      for (int j = 0; j < N; j++) {
+        T base = results[j];
+        T index = operands[1][j];
+        T inverseIndex = (T)1.0/index;
+        if (m_complexFormat == Preferences::ComplexFormat::Real && std::round(index) == index && std::pow((T)-1.0, index) < (T)0.0 && base != (T)0.0) {
+          T absRoot = std::pow(std::fabs(base), inverseIndex);
+          results[j] = base < (T)0.0 ? -absRoot : absRoot;
+        } else if (base != (T)0.0 && std::isfinite(inverseIndex) && (base > (T)0.0 || std::round(inverseIndex) == inverseIndex)) {
+          results[j] = std::pow(base, inverseIndex);
+        } else {
+          results[j] = NAN;
+        }
+      }
+      return;
+    case ExpressionNode::Type::Logarithm:
+      if (instruction.numberOfOperands == 2) {
+        for (int j = 0; j < N; j++) {
+          T base = operands[1][j];
+          results[j] = results[j] > (T)0.0 && base > (T)0.0 ? std::log10(results[j])/std::log10(base) : NAN;
+        }
+        return;
+      }
+      for (int j = 0; j < N; j++) {
+        results[j] = results[j] > (T)0.0 ? std::log10(results[j]) : NAN;
+      }
+      return;
+    case ExpressionNode::Type::NaperianLogarithm:
+      for (int j = 0; j < N; j++) {
+        results[j] = results[j] > (T)0.0 ? std::log(results[j]) : NAN;
+      }
+      return;
+    case ExpressionNode::Type::AbsoluteValue:
+      for (int j = 0; j < N; j++) {
+        results[j] = std::fabs(results[j]);
+      }
+      return;
+    case ExpressionNode::Type::SquareRoot:
+      for (int j = 0; j < N; j++) {
+        T result = std::sqrt(results[j]);
+        results[j] = results[j] > (T)0.0 && result > neglectThreshold ? result : NAN;
+      }
+      return;
+    case ExpressionNode::Type::Sine:
+    case ExpressionNode::Type::Cosine:
+    case ExpressionNode::Type::Tangent:
+    {
+      // Follow Trigonometry::ConvertToRadian
+      T toRadian = m_angleUnit == Preferences::AngleUnit::Radian ? (T)1.0 : (T)M_PI/(T)Trigonometry::PiInAngleUnit(m_angleUnit);
+      for (int j = 0; j < N; j++) {
+        T angle = results[j] * toRadian;
+        T result = instruction.type == ExpressionNode::Type::Sine ? std::sin(angle) : instruction.type == ExpressionNode::Type::Cosine ? std::cos(angle) : std::tan(angle);
+        results[j] = std::fabs(result) > neglectThreshold ? result : NAN;
+      }
+      return;
+    }
+    default:
+    {
+      assert(instruction.type == ExpressionNode::Type::ArcSine || instruction.type == ExpressionNode::Type::ArcCosine || instruction.type == ExpressionNode::Type::ArcTangent);
+      // Follow Trigonometry::ConvertRadianToAngleUnit
+      T fromRadian = m_angleUnit == Preferences::AngleUnit::Radian ? (T)1.0 : (T)Trigonometry::PiInAngleUnit(m_angleUnit)/(T)M_PI;
+      for (int j = 0; j < N; j++) {
+        T c = results[j];
+        T result = NAN;
+        if (instruction.type == ExpressionNode::Type::ArcTangent) {
+          result = std::atan(c);
+        } else if (std::fabs(c) <= (T)1.0) {
+          result = instruction.type == ExpressionNode::Type::ArcSine ? std::asin(c) : std::acos(c);
+        }
+        results[j] = std::fabs(result) > neglectThreshold ? result * fromRadian : NAN;
+      }
+      return;
+    }
+  }
+}
+
+template<typename T, int N>
+void ApproximationProgram::computeInstruction(const Instruction & instruction, const std::complex<T> operands[][N], const T * x, std::complex<T> results[N], int start, int end) const {
+  switch (instruction.type) {
+    case ExpressionNode::Type::Float:
+      for (int j = start; j < end; j++) {
+        results[j] = ComplexResult(std::complex<T>(m_constants[instruction.argument]));
+      }
+      return;
+    case ExpressionNode::Type::Symbol:
+      for (int j = start; j < end; j++) {
+        results[j] = ComplexResult(std::complex<T>(x[j]));
+      }
+      return;
+    case ExpressionNode::Type::Addition:
+    case ExpressionNode::Type::Multiplication:
+    {
+      bool isAddition = instruction.type == ExpressionNode::Type::Addition;
+      for (int j = start; j < end; j++) {
+        // Reduce the operands as ApproximationHelper::MapReduce does
+        std::complex<T> result = operands[0][j];
+        for (int k = 1; k < instruction.numberOfOperands; k++) {
+          std::complex<T> operand = operands[k][j];
+          result = ComplexResult(isAddition ? result + operand : result * operand);
+          if (IsUndefined(result)) {
+            break;
+          }
+        }
+        results[j] = result;
+      }
+      return;
+    }
+    case ExpressionNode::Type::Subtraction:
+      for (int j = start; j < end; j++) {
+        results[j] = ComplexResult(operands[0][j] - operands[1][j]);
+      }
+      return;
+    case ExpressionNode::Type::Division:
+      for (int j = start; j < end; j++) {
+        results[j] = DivisionNode::compute(operands[0][j], operands[1][j], m_complexFormat).stdComplex();
+      }
+      return;
+    case ExpressionNode::Type::Power:
+      for (int j = start; j < end; j++) {
+        results[j] = computePower(operands[0][j], operands[1][j], instruction.argument);
+      }
+      return;
+    case ExpressionNode::Type::NthRoot:
+      for (int j = start; j < end; j++) {
+        results[j] = computeNthRoot(operands[0][j], operands[1][j]);
+      }
+      return;
+    case ExpressionNode::Type::Logarithm:
+      if (instruction.numberOfOperands == 2) {
+        // Follow LogarithmNode<2>::templatedApproximate
+        for (int j = start; j < end; j++) {
+          std::complex<T> numerator = LogarithmNode<2>::computeOnComplex(operands[0][j], m_complexFormat, m_angleUnit).stdComplex();
+          std::complex<T> denominator = LogarithmNode<2>::computeOnComplex(operands[1][j], m_complexFormat, m_angleUnit).stdComplex();
+          results[j] = ComplexResult(DivisionNode::compute(numerator, denominator, m_complexFormat).stdComplex());
+        }
+        return;
+      }
+      for (int j = start; j < end; j++) {
+        results[j] = LogarithmNode<1>::computeOnComplex(operands[0][j], m_complexFormat, m_angleUnit).stdComplex();
+      }
+      return;
+    case ExpressionNode::Type::Opposite:
+      for (int j = start; j < end; j++) {
+        results[j] = ComplexResult(-operands[0][j]);
+      }
+      return;
+    default:
+    {
+      ApproximationHelper::ComplexCompute<T> compute = FunctionCompute<T>(instruction.type);
+      for (int j = start; j < end; j++) {
+        results[j] = compute(operands[0][j], m_complexFormat, m_angleUnit).stdComplex();
+      }
+      return;
+    }
+  }
+}
+
+bool ApproximationProgram::compileExpression(const Expression e, const char * symbol, Context * context, int * stackDepth) {
+  if (!DependsOnSymbols(e)) {
+    return compileConstant(e, context, stackDepth);
+  }
+  ExpressionNode::Type type = e.type();
+  if (type == ExpressionNode::Type::Symbol) {
+    return strcmp(static_cast<const Symbol &>(e).name(), symbol) == 0 && addInstruction(type, k_noArgument, 0, stackDepth);
+  }
+  int numberOfChildren = e.numberOfChildren();
+  uint8_t argument = k_noArgument;
+  switch (type) {
+    case ExpressionNode::Type::Power:
+      if (m_complexFormat == Preferences::ComplexFormat::Real) {
+        argument = rationalIndexConstant(e.childAtIndex(1));
+      }
+      break;
+    case ExpressionNode::Type::Addition:
+    case ExpressionNode::Type::Multiplication:
+    case ExpressionNode::Type::Logarithm:
+    case ExpressionNode::Type::NthRoot:
+    case ExpressionNode::Type::Subtraction:
+    case ExpressionNode::Type::Division:
+    case ExpressionNode::Type::Opposite:
+    case ExpressionNode::Type::AbsoluteValue:
+    case ExpressionNode::Type::SquareRoot:
+    case ExpressionNode::Type::NaperianLogarithm:
+    case ExpressionNode::Type::Sine:
+    case ExpressionNode::Type::Cosine:
+    case ExpressionNode::Type::Tangent:
+    case ExpressionNode::Type::ArcSine:
+    case ExpressionNode::Type::ArcCosine:
+    case ExpressionNode::Type::ArcTangent:
+      break;
+    default:
+      return false;
+  }
+  for (int i = 0; i < numberOfChildren; i++) {
+    if (!compileExpression(e.childAtIndex(i), symbol, context, stackDepth)) {
+      return false;
+    }
+  }
+  return addInstruction(type, argument, numberOfChildren, stackDepth);
+}
+
+bool ApproximationProgram::compileConstant(const Expression e, Context * context, int * stackDepth) {
+  Expression::SetEncounteredComplex(false);
+  Evaluation<double> evaluation = e.node()->approximate(double(), ExpressionNode::ApproximationContext(context, m_complexFormat, m_angleUnit));
+  if (evaluation.type() != EvaluationNode<double>::Type::Complex) {
+    return false;
+  }
+  m_constantsEncounteredComplex = m_constantsEncounteredComplex || Expression::EncounteredComplex();
+  std::complex<double> constant = static_cast<Complex<double> &>(evaluation).stdComplex();
+  m_constantsAreReal = m_constantsAreReal && constant.imag() == 0.0;
+  uint8_t index;
+  return addConstant(constant, &index) && addInstruction(ExpressionNode::Type::Float, index, 0, stackDepth);
+}
+
+bool ApproximationProgram::addInstruction(ExpressionNode::Type type, uint8_t argument, int numberOfOperands, int * stackDepth) {
+  if (m_numberOfInstructions >= k_maxNumberOfInstructions) {
+    return false;
+  }
+  // Every instruction pops its operands and pushes its result
+  *stackDepth += 1 - numberOfOperands;
+  if (*stackDepth > k_maxStackDepth) {
+    return false;
+  }
+  m_instructions[m_numberOfInstructions++] = {type, argument, static_cast<uint8_t>(numberOfOperands)};
+  return true;
+}
+
+bool ApproximationProgram::addConstant(std::complex<double> c, uint8_t * index) {
+  if (m_numberOfConstants >= k_maxNumberOfConstants) {
+    return false;
+  }
+  *index = m_numberOfConstants;
+  m_constants[m_numberOfConstants++] = c;
+  return true;
+}
+
+uint8_t ApproximationProgram::rationalIndexConstant(const Expression index) {
+  // Follow PowerNode::templatedApproximate
+  double p = NAN;
+  double q = NAN;
+  if (index.type() == ExpressionNode::Type::Rational) {
+    const Rational r = index.convert<Rational>();
+    p = r.signedIntegerNumerator().approximate<double>();
+    q = r.integerDenominator().approximate<double>();
+  } else if (index.type() == ExpressionNode::Type::Division && index.childAtIndex(0).type() == ExpressionNode::Type::Rational && index.childAtIndex(1).type() == ExpressionNode::Type::Rational) {
+    const Rational pRational = index.childAtIndex(0).convert<Rational>();
+    const Rational qRational = index.childAtIndex(1).convert<Rational>();
+    if (pRational.isInteger() && qRational.isInteger()) {
+      p = pRational.signedIntegerNumerator().approximate<double>();
+      q = qRational.signedIntegerNumerator().approximate<double>();
+    }
+  }
+  uint8_t constantIndex = k_noArgument;
+  if (std::isnan(p) || std::isnan(q) || !addConstant(std::complex<double>(p, q), &constantIndex)) {
+    return k_noArgument;
+  }
+  return constantIndex;
+}
+
+template<typename T>
+std::complex<T> ApproximationProgram::computePower(std::complex<T> c, std::complex<T> d, uint8_t rationalIndex) const {
+  if (rationalIndex != k_noArgument) {
+    assert(m_complexFormat == Preferences::ComplexFormat::Real);
+    std::complex<double> pq = m_constants[rationalIndex];
+    Complex<T> result = PowerNode::computeNotPrincipalRealRootOfRationalPow(c, (T)pq.real(), (T)pq.imag());
+    if (!result.isUndefined()) {
+      return result.stdComplex();
+    }
+  }
+  return PowerNode::compute(c, d, m_complexFormat).stdComplex();
+}
+
+template<typename T>
+std::complex<T> ApproximationProgram::computeNthRoot(std::complex<T> base, std::complex<T> index) const {
+  // Follow NthRootNode::templatedApproximate
+  if (m_complexFormat == Preferences::ComplexFormat::Real && index.imag() == (T)0.0 && std::round(index.real()) == index.real()) {
+    Complex<T> result = PowerNode::computeNotPrincipalRealRootOfRationalPow(base, (T)1.0, index.real());
+    if (!result.isUndefined()) {
+      return result.stdComplex();
+    }
+  }
+  return PowerNode::compute(base, std::complex<T>(1.0)/index, m_complexFormat).stdComplex();
+}
+
+template<typename T>
+ApproximationHelper::ComplexCompute<T> ApproximationProgram::FunctionCompute(ExpressionNode::Type type) {
+  switch (type) {
+    case ExpressionNode::Type::AbsoluteValue:
+      return AbsoluteValueNode::computeOnComplex<T>;
+    case ExpressionNode::Type::SquareRoot:
+      return SquareRootNode::computeOnComplex<T>;
+    case ExpressionNode::Type::NaperianLogarithm:
+      return NaperianLogarithmNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Sine:
+      return SineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Cosine:
+      return CosineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::Tangent:
+      return TangentNode::computeOnComplex<T>;
+    case ExpressionNode::Type::ArcSine:
+      return ArcSineNode::computeOnComplex<T>;
+    case ExpressionNode::Type::ArcCosine:
+      return ArcCosineNode::computeOnComplex<T>;
+    default:
+      assert(type == ExpressionNode::Type::ArcTangent);
+      return ArcTangentNode::computeOnComplex<T>;
+  }
+}
+
+template float ApproximationProgram::approximateWithValueForSymbol<float>(float) const;
+template double ApproximationProgram::approximateWithValueForSymbol<double>(double) const;
+template void ApproximationProgram::approximateWithValuesForSymbol<float>(const float *, float *, int) const;
+template void ApproximationProgram::approximateWithValuesForSymbol<double>(const double *, double *, int) const;
+
+}
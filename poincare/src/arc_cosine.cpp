@@ -60,4 +60,7 @@ Expression ArcCosine::shallowReduce(ExpressionNode::ReductionContext reductionCo
   return Trigonometry::shallowReduceInverseFunction(*this, reductionContext);
 }
 
+template Complex<float> ArcCosineNode::computeOnComplex<float>(const std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
+template Complex<double> ArcCosineNode::computeOnComplex<double>(const std::complex<double>, Preferences::ComplexFormat, Preferences::AngleUnit);
+
 }
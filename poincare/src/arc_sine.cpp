@@ -60,4 +60,7 @@ Expression ArcSine::shallowReduce(ExpressionNode::ReductionContext reductionCont
   return Trigonometry::shallowReduceInverseFunction(*this, reductionContext);
 }
 
+template Complex<float> ArcSineNode::computeOnComplex<float>(const std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
+template Complex<double> ArcSineNode::computeOnComplex<double>(const std::complex<double>, Preferences::ComplexFormat, Preferences::AngleUnit);
+
 }
@@ -59,4 +59,7 @@ Expression ArcTangent::shallowReduce(ExpressionNode::ReductionContext reductionC
   return Trigonometry::shallowReduceInverseFunction(*this, reductionContext);
 }
 
+template Complex<float> ArcTangentNode::computeOnComplex<float>(const std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
+template Complex<double> ArcTangentNode::computeOnComplex<double>(const std::complex<double>, Preferences::ComplexFormat, Preferences::AngleUnit);
+
 }
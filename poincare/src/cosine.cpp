@@ -63,4 +63,7 @@ Expression Cosine::unaryFunctionDifferential(ExpressionNode::ReductionContext re
   return Multiplication::Builder(Rational::Builder(-1), Trigonometry::UnitConversionFactor(reductionContext.angleUnit(), Preferences::AngleUnit::Radian), Sine::Builder(childAtIndex(0).clone()));
 }
 
+template Complex<float> CosineNode::computeOnComplex<float>(const std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
+template Complex<double> CosineNode::computeOnComplex<double>(const std::complex<double>, Preferences::ComplexFormat, Preferences::AngleUnit);
+
 }
@@ -95,4 +95,7 @@ Expression Division::shallowReduce(ExpressionNode::ReductionContext reductionCon
   return m.shallowReduce(reductionContext);
 }
 
+template Complex<float> DivisionNode::compute<float>(const std::complex<float>, const std::complex<float>, Preferences::ComplexFormat);
+template Complex<double> DivisionNode::compute<double>(const std::complex<double>, const std::complex<double>, Preferences::ComplexFormat);
+
 }
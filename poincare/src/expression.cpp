@@ -3,6 +3,7 @@
 #include <poincare/ghost.h>
 #include <poincare/opposite.h>
 #include <poincare/rational.h>
+#include <poincare/reduction_cache.h>
 #include <poincare/symbol.h>
 #include <poincare/undefined.h>
 #include <poincare/variable_context.h>
@@ -570,7 +571,11 @@ bool Expression::isReal(Context * context) const {
 
 bool Expression::isIdenticalTo(const Expression e) const {
   /* We use the simplification order only because it is a already-coded total
-   * order on expresssions. */
+   * order on expresssions. Cached structural hashes reject most different
+   * expressions without walking them. */
+  if (node()->structuralHash() != e.node()->structuralHash()) {
+    return false;
+  }
   return ExpressionNode::SimplificationOrder(node(), e.node(), true, true) == 0;
 }
 
@@ -835,10 +840,21 @@ Expression Expression::reduceAndRemoveUnit(ExpressionNode::ReductionContext redu
 
 Expression Expression::reduce(ExpressionNode::ReductionContext reductionContext) {
   sSimplificationHasBeenInterrupted = false;
+  /* Only root expressions are memoized as the reduction of a subtree can
+   * depend on its ancestors. */
+  ReductionCache * cache = ReductionCache::sharedCache();
+  uint16_t cacheEntryStamp = 0;
+  if (parent().isUninitialized()) {
+    Expression memoizedResult = cache->reducedExpression(*this, reductionContext, &cacheEntryStamp);
+    if (!memoizedResult.isUninitialized()) {
+      return memoizedResult;
+    }
+  }
   Expression result = deepReduce(reductionContext);
   if (sSimplificationHasBeenInterrupted) {
     return replaceWithUndefinedInPlace();
   }
+  cache->storeReducedExpression(cacheEntryStamp, result);
   return result;
 }
 
@@ -99,6 +99,28 @@ int ExpressionNode::simplificationOrderSameType(const ExpressionNode * e, bool a
   return 0;
 }
 
+uint8_t ExpressionNode::structuralHash() const {
+  uint8_t hash = cachedStructuralHash();
+  if (hash == NoStructuralHash) {
+    uint32_t fullHash = computeStructuralHash();
+    fullHash ^= fullHash >> 16;
+    hash = static_cast<uint8_t>(fullHash ^ (fullHash >> 8));
+    if (hash == NoStructuralHash) {
+      hash = 1;
+    }
+    setCachedStructuralHash(hash);
+  }
+  return hash;
+}
+
+uint32_t ExpressionNode::computeStructuralHash() const {
+  uint32_t hash = CombineStructuralHash(ShallowStructuralHash(type()), numberOfChildren());
+  for (ExpressionNode * c : children()) {
+    hash = CombineStructuralHash(hash, c->structuralHash());
+  }
+  return hash;
+}
+
 void ExpressionNode::deepReduceChildren(ExpressionNode::ReductionContext reductionContext) {
   Expression(this).defaultDeepReduceChildren(reductionContext);
 }
@@ -34,6 +34,26 @@ namespace Poincare {
 
 static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
 static native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
+/* The division works on copies of the normalized numerator and denominator,
+ * in base 2^16 so that every digit operation fits a native_uint_t. The
+ * numerator can have one more digit than usual, and one more half digit once
+ * normalized. */
+static native_uint_t s_workingBufferNumerator[Integer::k_maxNumberOfDigits + 2];
+static native_uint_t s_workingBufferDenominator[Integer::k_maxNumberOfDigits + 1];
+/* The multiplication computes the whole product before checking for overflow.
+ * The Karatsuba algorithm also needs the operands padded to the same size and
+ * space for the sums of their halves and the products of these sums. */
+static native_uint_t s_workingBufferMultiplication[2*(Integer::k_maxNumberOfDigits + 1)];
+static native_uint_t s_workingBufferKaratsuba[6*(Integer::k_maxNumberOfDigits + 1)];
+
+/* Below this number of digits, the schoolbook multiplication is faster than
+ * the Karatsuba multiplication. */
+constexpr static int k_karatsubaThreshold = 8;
+constexpr static int k_halfDigitBitCount = 8*sizeof(half_native_uint_t);
+constexpr static native_uint_t k_halfDigitBase = (native_uint_t)1 << k_halfDigitBitCount;
+// 10^4 is the largest power of 10 that is a half digit
+constexpr static half_native_uint_t k_largestPowerOf10HalfDigit = 10000;
+constexpr static int k_numberOfBase10DigitsInLargestPowerOf10HalfDigit = 4;
 
 uint8_t log2(native_uint_t v) {
   constexpr int nativeUnsignedIntegerBitCount = 8*sizeof(native_uint_t);
@@ -54,6 +74,113 @@ static inline int8_t sign(bool negative) {
   return 1 - 2*(int8_t)negative;
 }
 
+static int NumberOfSignificantDigits(const native_uint_t * digits, int numberOfDigits) {
+  while (numberOfDigits > 0 && digits[numberOfDigits-1] == 0) {
+    numberOfDigits--;
+  }
+  return numberOfDigits;
+}
+
+static int NumberOfDigitsForHalfDigits(half_native_uint_t * halfDigits, int numberOfHalfDigits) {
+  // Pad with a zero half digit to read the half digits as digits
+  if (numberOfHalfDigits % 2 == 1) {
+    halfDigits[numberOfHalfDigits++] = 0;
+  }
+  return NumberOfSignificantDigits(reinterpret_cast<native_uint_t *>(halfDigits), numberOfHalfDigits/2);
+}
+
+/* Divide the half digits of numerator by a half digit, from the most
+ * significant one so that quotient can be numerator. Return the remainder. */
+static half_native_uint_t DivideHalfDigits(const half_native_uint_t * numerator, int numberOfHalfDigits, half_native_uint_t divisor, half_native_uint_t * quotient) {
+  assert(divisor != 0);
+  native_uint_t remainder = 0;
+  for (int i = numberOfHalfDigits - 1; i >= 0; i--) {
+    native_uint_t n = remainder * k_halfDigitBase + numerator[i];
+    quotient[i] = n / divisor;
+    remainder = n % divisor;
+  }
+  return remainder;
+}
+
+static void MultiplyDigits(const native_uint_t * a, int aSize, const native_uint_t * b, int bSize, native_uint_t * product) {
+  memset(product, 0, (aSize + bSize)*sizeof(native_uint_t));
+  for (int i = 0; i < aSize; i++) {
+    double_native_uint_t aDigit = a[i];
+    double_native_uint_t carry = 0;
+    for (int j = 0; j < bSize; j++) {
+      /* aDigit has to be double_native, otherwise the product might end up
+       * being computed on single_native size. p is at most
+       * (2^32-1)^2 + 2*(2^32-1) = 2^64-1 and cannot overflow. */
+      double_native_uint_t p = aDigit*b[j] + carry + product[i+j];
+      product[i+j] = static_cast<native_uint_t>(p);
+      carry = p >> (8*sizeof(native_uint_t));
+    }
+    product[i+bSize] = static_cast<native_uint_t>(carry);
+  }
+}
+
+// a += b, with bSize <= aSize. Return the carry.
+static native_uint_t AddDigits(native_uint_t * a, int aSize, const native_uint_t * b, int bSize) {
+  assert(bSize <= aSize);
+  native_uint_t carry = 0;
+  for (int i = 0; i < aSize; i++) {
+    if (i >= bSize && carry == 0) {
+      break;
+    }
+    native_uint_t bDigit = i < bSize ? b[i] : 0;
+    native_uint_t sum = a[i] + bDigit + carry;
+    carry = (sum < a[i] || (carry && sum == a[i])) ? 1 : 0;
+    a[i] = sum;
+  }
+  return carry;
+}
+
+// a -= b, with bSize <= aSize and b <= a
+static void SubtractDigits(native_uint_t * a, int aSize, const native_uint_t * b, int bSize) {
+  assert(bSize <= aSize);
+  native_uint_t borrow = 0;
+  for (int i = 0; i < aSize; i++) {
+    if (i >= bSize && borrow == 0) {
+      break;
+    }
+    native_uint_t bDigit = i < bSize ? b[i] : 0;
+    native_uint_t difference = a[i] - bDigit - borrow;
+    borrow = (difference > a[i] || (borrow && difference == a[i])) ? 1 : 0;
+    a[i] = difference;
+  }
+  assert(borrow == 0);
+}
+
+/* Karatsuba multiplication of a and b of n digits into the 2n digits of
+ * product. With a = a1*B^l + a0 and b = b1*B^l + b0:
+ * a*b = a1*b1*B^2l + ((a0+a1)*(b0+b1) - a0*b0 - a1*b1)*B^l + a0*b0
+ * scratch has to hold 4*(h+1) digits at each level of recursion, where h is
+ * the size of the upper halves. */
+static void KaratsubaMultiplyDigits(const native_uint_t * a, const native_uint_t * b, int n, native_uint_t * product, native_uint_t * scratch) {
+  if (n < k_karatsubaThreshold) {
+    MultiplyDigits(a, n, b, n, product);
+    return;
+  }
+  int l = n/2;
+  int h = n - l;
+  // a0*b0 and a1*b1 are computed in the lower and upper digits of product
+  KaratsubaMultiplyDigits(a, b, l, product, scratch);
+  KaratsubaMultiplyDigits(a + l, b + l, h, product + 2*l, scratch);
+  native_uint_t * aSum = scratch;
+  native_uint_t * bSum = scratch + (h + 1);
+  native_uint_t * middle = scratch + 2*(h + 1);
+  memcpy(aSum, a + l, h*sizeof(native_uint_t));
+  memcpy(bSum, b + l, h*sizeof(native_uint_t));
+  aSum[h] = AddDigits(aSum, h, a, l);
+  bSum[h] = AddDigits(bSum, h, b, l);
+  KaratsubaMultiplyDigits(aSum, bSum, h + 1, middle, scratch + 4*(h + 1));
+  SubtractDigits(middle, 2*(h + 1), product, 2*l);
+  SubtractDigits(middle, 2*(h + 1), product + 2*l, 2*h);
+  native_uint_t carry = AddDigits(product + l, 2*n - l, middle, 2*(h + 1));
+  assert(carry == 0);
+  (void)carry;
+}
+
 IntegerNode::IntegerNode(const native_uint_t * digits, uint8_t numberOfDigits) :
   m_numberOfDigits(numberOfDigits)
 {
@@ -209,11 +336,6 @@ int Integer::serialize(char * buffer, int bufferSize, Base base) const {
 }
 
 int Integer::serializeInDecimal(char * buffer, int bufferSize) const {
-  Integer base(10);
-  Integer abs = *this;
-  abs.setNegative(false);
-  IntegerDivision d = udiv(abs, base);
-
   int length = 0;
   if (isZero()) {
     length += SerializationHelper::CodePoint(buffer + length, bufferSize - length, '0');
@@ -221,14 +343,26 @@ int Integer::serializeInDecimal(char * buffer, int bufferSize) const {
     length += SerializationHelper::CodePoint(buffer + length, bufferSize - length, '-');
   }
 
-  while (!(d.remainder.isZero() &&
-        d.quotient.isZero())) {
-    char c = char_from_digit(d.remainder.isZero() ? 0 : d.remainder.digit(0));
-    if (length >= bufferSize-1) {
-      return PrintFloat::ConvertFloatToText<float>(NAN, buffer, bufferSize, PrintFloat::k_maxFloatGlyphLength, PrintFloat::k_numberOfStoredSignificantDigits, Preferences::PrintFloatMode::Decimal).CharLength;
+  /* Divide a copy of the half digits by 10^4 in place. Each division gives
+   * the next four decimal digits, from the least significant one. */
+  half_native_uint_t * quotient = reinterpret_cast<half_native_uint_t *>(s_workingBuffer);
+  int quotientSize = numberOfHalfDigits();
+  for (int i = 0; i < quotientSize; i++) {
+    quotient[i] = halfDigit(i);
+  }
+  while (quotientSize > 0) {
+    half_native_uint_t remainder = DivideHalfDigits(quotient, quotientSize, k_largestPowerOf10HalfDigit, quotient);
+    while (quotientSize > 0 && quotient[quotientSize-1] == 0) {
+      quotientSize--;
+    }
+    // The most significant digits are not padded with zeros
+    for (int i = 0; i < k_numberOfBase10DigitsInLargestPowerOf10HalfDigit && (quotientSize > 0 || remainder > 0); i++) {
+      if (length >= bufferSize-1) {
+        return PrintFloat::ConvertFloatToText<float>(NAN, buffer, bufferSize, PrintFloat::k_maxFloatGlyphLength, PrintFloat::k_numberOfStoredSignificantDigits, Preferences::PrintFloatMode::Decimal).CharLength;
+      }
+      length += SerializationHelper::CodePoint(buffer + length, bufferSize - length, char_from_digit(remainder % 10));
+      remainder /= 10;
     }
-    length += SerializationHelper::CodePoint(buffer + length, bufferSize - length, c);
-    d = udiv(d.quotient, base);
   }
   assert(length <= bufferSize - 1);
   buffer[length] = 0;
@@ -386,14 +520,28 @@ T Integer::approximate() const {
 
 int Integer::NumberOfBase10DigitsWithoutSign(const Integer & i) {
   assert(!i.isOverflow());
-  int numberOfDigits = 1;
-  Integer base(10);
-  IntegerDivision d = udiv(i, base);
-  while (!d.quotient.isZero()) {
-    d = udiv(d.quotient, base);
-    numberOfDigits++;
+  half_native_uint_t * quotient = reinterpret_cast<half_native_uint_t *>(s_workingBuffer);
+  int quotientSize = i.numberOfHalfDigits();
+  for (int k = 0; k < quotientSize; k++) {
+    quotient[k] = i.halfDigit(k);
+  }
+  int numberOfDigits = 0;
+  while (quotientSize > 0) {
+    half_native_uint_t remainder = DivideHalfDigits(quotient, quotientSize, k_largestPowerOf10HalfDigit, quotient);
+    while (quotientSize > 0 && quotient[quotientSize-1] == 0) {
+      quotientSize--;
+    }
+    if (quotientSize > 0) {
+      numberOfDigits += k_numberOfBase10DigitsInLargestPowerOf10HalfDigit;
+    } else {
+      while (remainder > 0) {
+        numberOfDigits++;
+        remainder /= 10;
+      }
+    }
   }
-  return numberOfDigits;
+  // 0 has one digit
+  return std::max(numberOfDigits, 1);
 }
 
 // Comparison
@@ -424,16 +572,28 @@ IntegerDivision Integer::Division(const Integer & numerator, const Integer & den
 }
 
 Integer Integer::Power(const Integer & i, const Integer & j) {
-  // TODO: optimize with dichotomia
   assert(!j.isNegative());
   if (j.isOverflow()) {
     return Overflow(false);
   }
-  Integer index(j);
+  /* Exponentiation by squaring: result is the product of the i^(2^k) for the
+   * bits k of j. i^(2^k) is lower than i^j for every bit k of j unless i is 0
+   * or 1, so an overflow of the squares means an overflow of the result. */
   Integer result(1);
-  while (!index.isZero()) {
-    result = Multiplication(result, i);
-    index = usum(index, Integer(1), true);
+  Integer square(i);
+  int numberOfDigits = j.numberOfDigits();
+  for (int d = 0; d < numberOfDigits; d++) {
+    native_uint_t exponentDigit = j.digit(d);
+    for (int bit = 0; bit < 8*(int)sizeof(native_uint_t); bit++) {
+      if (exponentDigit & 1) {
+        result = Multiplication(result, square);
+      }
+      exponentDigit >>= 1;
+      if (d == numberOfDigits - 1 && exponentDigit == 0) {
+        return result;
+      }
+      square = Multiplication(square, square);
+    }
   }
   return result;
 }
@@ -480,45 +640,43 @@ Integer Integer::multiplication(const Integer & a, const Integer & b, bool oneDi
   if (a.isOverflow() || b.isOverflow()) {
     return Integer::Overflow(a.m_negative != b.m_negative);
   }
+  int aSize = a.numberOfDigits();
+  int bSize = b.numberOfDigits();
+  if (aSize == 0 || bSize == 0) {
+    return Integer(0);
+  }
+  int maxNumberOfDigits = k_maxNumberOfDigits + oneDigitOverflow; // Enable overflowing of 1 digit
+  // The product of integers of aSize and bSize digits has at least aSize+bSize-1 digits
+  if (aSize + bSize - 1 > maxNumberOfDigits) {
+    return Integer::Overflow(a.m_negative != b.m_negative);
+  }
 
-  uint8_t size = std::min(a.numberOfDigits() + b.numberOfDigits(), k_maxNumberOfDigits + oneDigitOverflow); // Enable overflowing of 1 digit
-
-  memset(s_workingBuffer, 0, size*sizeof(native_uint_t));
-
-  double_native_uint_t carry = 0;
-  for (uint8_t i = 0; i < a.numberOfDigits(); i++) {
-    double_native_uint_t aDigit = a.digit(i);
-    carry = 0;
-    for (uint8_t j = 0; j < b.numberOfDigits(); j++) {
-      double_native_uint_t bDigit = b.digit(j);
-      /* The fact that aDigit and bDigit are double_native is very important,
-       * otherwise the product might end up being computed on single_native size
-       * and then zero-padded. */
-      double_native_uint_t p = aDigit*bDigit + carry + (double_native_uint_t)(s_workingBuffer[i+j]); // TODO: Prove it cannot overflow double_native type
-      native_uint_t * l = (native_uint_t *)&p;
-      if (i+j < (uint8_t) k_maxNumberOfDigits+oneDigitOverflow) {
-        s_workingBuffer[i+j] = l[0];
-      } else {
-        if (l[0] != 0) {
-          // Overflow the largest Integer
-          return Integer::Overflow(a.m_negative != b.m_negative);
-        }
-      }
-      carry = l[1];
-    }
-    if (i+b.numberOfDigits() < (uint8_t) k_maxNumberOfDigits+oneDigitOverflow) {
-      s_workingBuffer[i+b.numberOfDigits()] += carry;
-    } else {
-      if (carry != 0) {
-        // Overflow the largest Integer
-        return Integer::Overflow(a.m_negative != b.m_negative);
-      }
+  native_uint_t * product = s_workingBufferMultiplication;
+  if (std::min(aSize, bSize) >= k_karatsubaThreshold) {
+    // Pad the smallest operand with zeros
+    int n = std::max(aSize, bSize);
+    const native_uint_t * aDigits = a.digits();
+    const native_uint_t * bDigits = b.digits();
+    native_uint_t * padded = s_workingBufferKaratsuba;
+    if (aSize < n) {
+      memcpy(padded, aDigits, aSize*sizeof(native_uint_t));
+      memset(padded + aSize, 0, (n - aSize)*sizeof(native_uint_t));
+      aDigits = padded;
+    } else if (bSize < n) {
+      memcpy(padded, bDigits, bSize*sizeof(native_uint_t));
+      memset(padded + bSize, 0, (n - bSize)*sizeof(native_uint_t));
+      bDigits = padded;
     }
+    KaratsubaMultiplyDigits(aDigits, bDigits, n, product, s_workingBufferKaratsuba + n);
+  } else {
+    MultiplyDigits(a.digits(), aSize, b.digits(), bSize, product);
   }
-  while (size>0 && s_workingBuffer[size-1] == 0) {
-    size--;
+  int size = NumberOfSignificantDigits(product, aSize + bSize);
+  if (size > maxNumberOfDigits) {
+    // Overflow the largest Integer
+    return Integer::Overflow(a.m_negative != b.m_negative);
   }
-  return BuildInteger(s_workingBuffer, size, a.m_negative != b.m_negative, oneDigitOverflow);
+  return BuildInteger(product, size, a.m_negative != b.m_negative, oneDigitOverflow);
 }
 
 int8_t Integer::ucmp(const Integer & a, const Integer & b) {
@@ -581,42 +739,6 @@ Integer Integer::usum(const Integer & a, const Integer & b, bool subtract, bool
   return BuildInteger(s_workingBuffer, size, false, oneDigitOverflow);
 }
 
-Integer Integer::multiplyByPowerOf2(uint8_t pow) const {
-  assert(pow < 32);
-  native_uint_t carry = 0;
-  for (uint8_t i = 0; i < numberOfDigits(); i++) {
-    s_workingBuffer[i] = digit(i) << pow | carry;
-    carry = pow == 0 ? 0 : digit(i) >> (32-pow);
-  }
-  s_workingBuffer[numberOfDigits()] = carry;
-  return BuildInteger(s_workingBuffer, carry ? numberOfDigits() + 1 : numberOfDigits(), false, true);
-}
-
-Integer Integer::divideByPowerOf2(uint8_t pow) const {
-  assert(pow < 32);
-  native_uint_t carry = 0;
-  for (int i = numberOfDigits() - 1; i >= 0; i--) {
-    s_workingBuffer[i] = digit(i) >> pow | carry;
-    carry = pow == 0 ? 0 : digit(i) << (32-pow);
-  }
-  return BuildInteger(s_workingBuffer, s_workingBuffer[numberOfDigits()-1] > 0 ? numberOfDigits() : numberOfDigits()-1, false, true);
-}
-
-// return this*(2^16)^pow
-Integer Integer::multiplyByPowerOfBase(uint8_t pow) const {
-  int nbOfHalfDigits = numberOfHalfDigits();
-  half_native_uint_t * digits = reinterpret_cast<half_native_uint_t *>(s_workingBuffer);
-  /* The number of half digits of the built integer is nbOfHalfDigits+pow.
-   * Still, we set an extra half digit to 0 to easily convert half digits to
-   * digits. */
-  memset(digits, 0, sizeof(half_native_uint_t)*(nbOfHalfDigits+pow+1));
-  for (uint8_t i = 0; i < nbOfHalfDigits; i++) {
-    digits[i+pow] = halfDigit(i);
-  }
-  nbOfHalfDigits += pow;
-  return BuildInteger((native_uint_t *)digits, nbOfHalfDigits%2 == 1 ? nbOfHalfDigits/2+1 : nbOfHalfDigits/2, false, true);
-}
-
 IntegerDivision Integer::udiv(const Integer & numerator, const Integer & denominator) {
   if (denominator.isOverflow()) {
     return {.quotient = Overflow(false), .remainder = Integer::Overflow(false)};
@@ -624,65 +746,98 @@ IntegerDivision Integer::udiv(const Integer & numerator, const Integer & denomin
   if (numerator.isOverflow()) {
     return {.quotient = Overflow(false), .remainder = Integer::Overflow(false)};
   }
-  /* Modern Computer Arithmetic, Richard P. Brent and Paul Zimmermann
-   * (Algorithm 1.6) */
   assert(!denominator.isZero());
   if (ucmp(numerator,denominator) < 0) {
     IntegerDivision div = {.quotient = Integer(0), .remainder = Integer(numerator)};
     return div;
   }
-  /* Let's call beta = 1 << 16 */
-  /* Normalize numerator & denominator:
+  /* Let's call beta = 1 << 16. The division is computed in base beta on
+   * arrays of half digits:
+   * A = a[0] + a[1]*beta + ... + a[n+m-1]*beta^(n+m-1)
+   * B = b[0] + b[1]*beta + ... + b[n-1]*beta^(n-1) */
+  int n = denominator.numberOfHalfDigits();
+  int m = numerator.numberOfHalfDigits() - n;
+  // The quotient q has at maximum m+1 half digits
+  half_native_uint_t * q = reinterpret_cast<half_native_uint_t *>(s_workingBufferDivision);
+  half_native_uint_t * a = reinterpret_cast<half_native_uint_t *>(s_workingBufferNumerator);
+
+  if (n == 1) {
+    for (int i = 0; i < n + m; i++) {
+      a[i] = numerator.halfDigit(i);
+    }
+    half_native_uint_t r = DivideHalfDigits(a, n + m, denominator.halfDigit(0), q);
+    return {.quotient = BuildInteger(s_workingBufferDivision, NumberOfDigitsForHalfDigits(q, m + 1), false), .remainder = Integer(static_cast<native_int_t>(r))};
+  }
+
+  /* Modern Computer Arithmetic, Richard P. Brent and Paul Zimmermann
+   * (Algorithm 1.6), with the quotient estimation refined as in Knuth's
+   * Algorithm D so that it needs at most one correction.
+   * Normalize numerator & denominator:
    * Find A = 2^k*numerator & B = 2^k*denominator such as B > beta/2
    * if A = B*Q+R (R < B) then numerator = denominator*Q + R/2^k. */
-  half_native_uint_t b = denominator.halfDigit(denominator.numberOfHalfDigits()-1);
-  half_native_uint_t halfBase = 1 << (16-1);
+  half_native_uint_t * b = reinterpret_cast<half_native_uint_t *>(s_workingBufferDenominator);
   int pow = 0;
-  assert(b != 0);
-  while (!(b & halfBase)) {
-    b = b << 1;
+  assert(denominator.halfDigit(n-1) != 0);
+  while (!((denominator.halfDigit(n-1) << pow) & (k_halfDigitBase >> 1))) {
     pow++;
   }
-  Integer A = numerator.multiplyByPowerOf2(pow);
-  Integer B = denominator.multiplyByPowerOf2(pow);
-
-  /* A = a[0] + a[1]*beta + ... + a[n+m-1]*beta^(n+m-1)
-   * B = b[0] + b[1]*beta + ... + b[n-1]*beta^(n-1) */
-  int n = B.numberOfHalfDigits();
-  int m = A.numberOfHalfDigits()-n;
-  // qDigits is a half_native_uint_t array and enable one digit overflow
-  half_native_uint_t * qDigits = reinterpret_cast<half_native_uint_t *>(s_workingBufferDivision);
-  // The quotient q has at maximum m+1 half digits but we set an extra half digit to 0 to enable to easily convert it from half digits to digits
-  memset(qDigits, 0, std::max(m+1+1,2*k_maxNumberOfDigits)*sizeof(half_native_uint_t));
-  // betaMB = B*beta^m
-  Integer betaMB = B.multiplyByPowerOfBase(m);
-  if (Integer::NaturalOrder(A,betaMB) >= 0) { // A >= B*beta^m
-    qDigits[m] = 1; // q[m] = 1
-    A = usum(A, betaMB, true, true); // A-B*beta^m
-  }
-  native_int_t base = 1 << 16;
-  for (int j = m-1; j >= 0; j--) {
-    native_uint_t qj2 = ((native_uint_t)A.halfDigit(n+j)*base+(native_uint_t)A.halfDigit(n+j-1))/(native_uint_t)B.halfDigit(n-1); // (a[n+j]*beta+a[n+j-1])/b[n-1]
-    half_native_uint_t baseMinus1 = (1 << 16) -1; // beta-1
-    qDigits[j] = qj2 < (native_uint_t)baseMinus1 ? (half_native_uint_t)qj2 : baseMinus1; // std::min(qj2, beta -1)
-    A = Integer::addition(A, multiplication(qDigits[j], B.multiplyByPowerOfBase(j), true), true, true); // A-q[j]*beta^j*B
-    if (A.isNegative()) {
-      Integer betaJM = B.multiplyByPowerOfBase(j); // betaJM = B*beta^j
-      while (A.isNegative()) {
-        qDigits[j] = qDigits[j]-1; // q[j] = q[j]-1
-        A = addition(A, betaJM, false, true); // A = B*beta^j+A
+  for (int i = n - 1; i > 0; i--) {
+    b[i] = (denominator.halfDigit(i) << pow) | ((native_uint_t)denominator.halfDigit(i-1) >> (k_halfDigitBitCount - pow));
+  }
+  b[0] = denominator.halfDigit(0) << pow;
+  a[n + m] = (native_uint_t)numerator.halfDigit(n+m-1) >> (k_halfDigitBitCount - pow);
+  for (int i = n + m - 1; i > 0; i--) {
+    a[i] = (numerator.halfDigit(i) << pow) | ((native_uint_t)numerator.halfDigit(i-1) >> (k_halfDigitBitCount - pow));
+  }
+  a[0] = numerator.halfDigit(0) << pow;
+
+  for (int j = m; j >= 0; j--) {
+    /* Estimate q[j] with (a[n+j]*beta+a[n+j-1])/b[n-1]. As a[n+j] <= b[n-1],
+     * qj is at most beta+1 and every product below fits a native_uint_t. */
+    native_uint_t numeratorHead = (native_uint_t)a[n+j]*k_halfDigitBase + a[n+j-1];
+    native_uint_t qj = numeratorHead / b[n-1];
+    native_uint_t rj = numeratorHead - qj*b[n-1];
+    while (qj >= k_halfDigitBase || qj*b[n-2] > rj*k_halfDigitBase + a[n+j-2]) {
+      qj--;
+      rj += b[n-1];
+      if (rj >= k_halfDigitBase) {
+        break;
       }
     }
+    // A = A - q[j]*beta^j*B
+    native_int_t borrow = 0;
+    native_int_t t;
+    for (int i = 0; i < n; i++) {
+      native_uint_t p = qj*b[i];
+      t = a[i+j] - borrow - (native_int_t)(p & (k_halfDigitBase - 1));
+      a[i+j] = t;
+      borrow = (native_int_t)(p >> k_halfDigitBitCount) - (t >> k_halfDigitBitCount);
+    }
+    t = a[j+n] - borrow;
+    a[j+n] = t;
+    if (t < 0) {
+      // qj was one too large: A = A + beta^j*B
+      qj--;
+      native_uint_t carry = 0;
+      for (int i = 0; i < n; i++) {
+        native_uint_t s = (native_uint_t)a[i+j] + b[i] + carry;
+        a[i+j] = s;
+        carry = s >> k_halfDigitBitCount;
+      }
+      a[j+n] += carry;
+    }
+    q[j] = qj;
   }
-  int qNumberOfDigits = m+1;
-  while (qDigits[qNumberOfDigits-1] == 0 && qNumberOfDigits > 1) {
-    qNumberOfDigits--;
-  }
-  int qNumberOfDigitsInBase32 = qNumberOfDigits%2 == 1 ? qNumberOfDigits/2+1 : qNumberOfDigits/2;
-  IntegerDivision div = {.quotient = BuildInteger((native_uint_t *)qDigits, qNumberOfDigitsInBase32, false), .remainder = A};
-  if (pow > 0 && !div.remainder.isZero()) {
-    div.remainder = div.remainder.divideByPowerOf2(pow);
+
+  // The remainder is the lower n half digits of A divided by 2^k
+  half_native_uint_t * r = reinterpret_cast<half_native_uint_t *>(s_workingBuffer);
+  for (int i = 0; i < n; i++) {
+    r[i] = (a[i] >> pow) | ((native_uint_t)a[i+1] << (k_halfDigitBitCount - pow));
   }
+  IntegerDivision div = {
+    .quotient = BuildInteger(s_workingBufferDivision, NumberOfDigitsForHalfDigits(q, m + 1), false),
+    .remainder = BuildInteger(s_workingBuffer, NumberOfDigitsForHalfDigits(r, n), false, true)
+  };
   return div;
 }
 
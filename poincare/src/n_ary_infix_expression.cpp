@@ -54,4 +54,13 @@ int NAryInfixExpressionNode::simplificationOrderGreaterType(const ExpressionNode
   return 0;
 }
 
+uint32_t NAryInfixExpressionNode::computeStructuralHash() const {
+  /* A single-operand hierarchy has the same order as its operand, so it has to
+   * share its hash. */
+  if (numberOfChildren() == 1) {
+    return childAtIndex(0)->structuralHash();
+  }
+  return ExpressionNode::computeStructuralHash();
+}
+
 }
\ No newline at end of file
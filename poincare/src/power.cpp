@@ -238,6 +238,12 @@ int PowerNode::simplificationOrderGreaterType(const ExpressionNode * e, bool asc
   return SimplificationOrder(childAtIndex(1), one.node(), ascending, canBeInterrupted, ignoreParentheses);
 }
 
+uint32_t PowerNode::computeStructuralHash() const {
+  /* x^1 has the same order as x, so a power is only hashed by its base: powers
+   * of the same base collide, which only disables the fast path. */
+  return childAtIndex(0)->structuralHash();
+}
+
 int PowerNode::simplificationOrderSameType(const ExpressionNode * e, bool ascending, bool canBeInterrupted, bool ignoreParentheses) const {
   assert(e->numberOfChildren() > 0);
   int baseComparison = SimplificationOrder(childAtIndex(0), e->childAtIndex(0), ascending, canBeInterrupted, ignoreParentheses);
@@ -15,6 +15,9 @@ namespace Poincare {
 
 /* Rational Node */
 
+// The sign and the digit counts fit in the padding of the TreeNode header
+static_assert(sizeof(RationalNode) == sizeof(TreeNode), "RationalNode should not grow the TreeNode header");
+
 RationalNode::RationalNode(const native_uint_t * numeratorDigits, uint8_t numeratorSize, const native_uint_t * denominatorDigits, uint8_t denominatorSize, bool negative) :
   m_negative(negative),
   m_numberOfDigitsNumerator(numeratorSize),
@@ -0,0 +1,146 @@
+#include <poincare/reduction_cache.h>
+#include <poincare/helpers.h>
+#include <string.h>
+
+namespace Poincare {
+
+ReductionCache * ReductionCache::sharedCache() {
+  static ReductionCache cache;
+  return &cache;
+}
+
+ReductionCache::ReductionCache() :
+  m_nextEntryIndex(0),
+  m_lastStamp(k_emptyStamp),
+  m_enabled(true),
+  m_numberOfHits(0),
+  m_numberOfMisses(0)
+{}
+
+Expression ReductionCache::reducedExpression(const Expression e, ExpressionNode::ReductionContext reductionContext, uint16_t * entryStamp) {
+  *entryStamp = k_emptyStamp;
+  if (!m_enabled || !IsMemoizable(e)) {
+    return Expression();
+  }
+  uint32_t key = ReductionContextKey(reductionContext);
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    if (m_entries[i].matches(e, key)) {
+      m_numberOfHits++;
+      return m_entries[i].output();
+    }
+  }
+  m_numberOfMisses++;
+  /* Entries are recycled in a round-robin fashion. A nested reduction can
+   * recycle the entry before the outer reduction is over, hence the stamps. */
+  Entry * entry = m_entries + m_nextEntryIndex;
+  m_nextEntryIndex = (m_nextEntryIndex + 1) % k_numberOfEntries;
+  m_lastStamp = m_lastStamp == UINT16_MAX ? k_emptyStamp + 1 : m_lastStamp + 1;
+  if (entry->setInput(m_lastStamp, e, key)) {
+    *entryStamp = m_lastStamp;
+  }
+  return Expression();
+}
+
+void ReductionCache::storeReducedExpression(uint16_t entryStamp, const Expression reducedExpression) {
+  if (entryStamp == k_emptyStamp) {
+    return;
+  }
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    Entry * entry = m_entries + i;
+    if (entry->stamp() == entryStamp && !entry->isComplete()) {
+      if (!entry->setOutput(reducedExpression)) {
+        entry->invalidate();
+      }
+      return;
+    }
+  }
+}
+
+void ReductionCache::clear() {
+  for (int i = 0; i < k_numberOfEntries; i++) {
+    m_entries[i].invalidate();
+  }
+  m_numberOfHits = 0;
+  m_numberOfMisses = 0;
+}
+
+bool ReductionCache::TreesHaveSameContent(const Expression e1, const Expression e2) {
+  size_t size = e1.size();
+  return e2.size() == size && TreesHaveSameContent(static_cast<const TreeNode *>(e1.addressInPool()), static_cast<const TreeNode *>(e2.addressInPool()), size);
+}
+
+bool ReductionCache::IsMemoizable(const Expression e) {
+  return !e.hasExpression([](const Expression e, const void * context) {
+        return e.isRandom()
+          || e.type() == ExpressionNode::Type::Symbol
+          || e.type() == ExpressionNode::Type::Function
+          || e.type() == ExpressionNode::Type::Sequence;
+      }, nullptr);
+}
+
+uint32_t ReductionCache::ReductionContextKey(ExpressionNode::ReductionContext reductionContext) {
+  return static_cast<uint32_t>(reductionContext.complexFormat())
+    | static_cast<uint32_t>(reductionContext.angleUnit()) << 4
+    | static_cast<uint32_t>(reductionContext.unitFormat()) << 8
+    | static_cast<uint32_t>(reductionContext.target()) << 12
+    | static_cast<uint32_t>(reductionContext.symbolicComputation()) << 16
+    | static_cast<uint32_t>(reductionContext.unitConversion()) << 20;
+}
+
+bool ReductionCache::TreesHaveSameContent(const TreeNode * n1, const TreeNode * n2, size_t size) {
+  const TreeNode * end = reinterpret_cast<const TreeNode *>(reinterpret_cast<const char *>(n1) + size);
+  while (n1 < end) {
+    if (!n1->hasSameContentAs(n2)) {
+      return false;
+    }
+    n1 = n1->next();
+    n2 = n2->next();
+  }
+  return true;
+}
+
+// Entry
+
+bool ReductionCache::Entry::matches(const Expression e, uint32_t reductionContextKey) const {
+  return m_isComplete
+    && m_reductionContextKey == reductionContextKey
+    && m_inputSize == e.size()
+    && TreesHaveSameContent(input(), static_cast<const TreeNode *>(e.addressInPool()), m_inputSize);
+}
+
+bool ReductionCache::Entry::setInput(uint16_t stamp, const Expression e, uint32_t reductionContextKey) {
+  invalidate();
+  size_t size = e.size();
+  if (size > k_entryBufferSize) {
+    return false;
+  }
+  memcpy(m_buffer, e.addressInPool(), size);
+  m_stamp = stamp;
+  m_inputSize = size;
+  m_reductionContextKey = reductionContextKey;
+  return true;
+}
+
+bool ReductionCache::Entry::setOutput(const Expression e) {
+  size_t size = e.size();
+  if (outputOffset() + size > k_entryBufferSize) {
+    return false;
+  }
+  memcpy(reinterpret_cast<char *>(m_buffer) + outputOffset(), e.addressInPool(), size);
+  m_outputSize = size;
+  m_isComplete = true;
+  return true;
+}
+
+Expression ReductionCache::Entry::output() const {
+  assert(m_isComplete);
+  Expression result = Expression::ExpressionFromAddress(reinterpret_cast<const char *>(m_buffer) + outputOffset(), m_outputSize);
+  result.deleteParentIdentifier();
+  return result;
+}
+
+size_t ReductionCache::Entry::outputOffset() const {
+  return Helpers::AlignedSize(m_inputSize, ByteAlignment);
+}
+
+}
@@ -61,4 +61,7 @@ Expression Sine::unaryFunctionDifferential(ExpressionNode::ReductionContext redu
   return Multiplication::Builder(Trigonometry::UnitConversionFactor(reductionContext.angleUnit(), Preferences::AngleUnit::Radian), Cosine::Builder(childAtIndex(0).clone()));
 }
 
+template Complex<float> SineNode::computeOnComplex<float>(const std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
+template Complex<double> SineNode::computeOnComplex<double>(const std::complex<double>, Preferences::ComplexFormat, Preferences::AngleUnit);
+
 }
@@ -53,4 +53,7 @@ Expression SquareRoot::shallowReduce(ExpressionNode::ReductionContext reductionC
   return p.shallowReduce(reductionContext);
 }
 
+template Complex<float> SquareRootNode::computeOnComplex<float>(const std::complex<float>, Preferences::ComplexFormat, Preferences::AngleUnit);
+template Complex<double> SquareRootNode::computeOnComplex<double>(const std::complex<double>, Preferences::ComplexFormat, Preferences::AngleUnit);
+
 }
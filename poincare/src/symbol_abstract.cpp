@@ -40,6 +40,15 @@ int SymbolAbstractNode::simplificationOrderSameType(const ExpressionNode * e, bo
   return strcmp(name(), static_cast<const SymbolAbstractNode *>(e)->name());
 }
 
+uint32_t SymbolAbstractNode::computeStructuralHash() const {
+  // Symbols are only ordered by name, f(x) and f(y) have the same order
+  uint32_t hash = ShallowStructuralHash(type());
+  for (const char * c = name(); *c != 0; c++) {
+    hash = CombineStructuralHash(hash, *c);
+  }
+  return hash;
+}
+
 int SymbolAbstractNode::serialize(char * buffer, int bufferSize, Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
   return std::min<int>(strlcpy(buffer, name(), bufferSize), bufferSize - 1);
 }
@@ -76,6 +76,7 @@ void TreeHandle::replaceChildInPlace(TreeHandle oldChild, TreeHandle newChild) {
   TreePool::sharedPool()->move(TreePool::sharedPool()->last(), oldChild.node(), oldChild.numberOfChildren());
   oldChild.node()->release(oldChild.numberOfChildren());
   oldChild.deleteParentIdentifier();
+  node()->invalidateStructuralHash();
 }
 
 void TreeHandle::replaceChildAtIndexInPlace(int oldChildIndex, TreeHandle newChild) {
@@ -104,6 +105,8 @@ void TreeHandle::mergeChildrenAtIndexInPlace(TreeHandle t, int i) {
   }
   node()->incrementNumberOfChildren(numberOfNewChildren);
   t.node()->eraseNumberOfChildren();
+  t.node()->invalidateStructuralHash();
+  node()->invalidateStructuralHash();
   for (int j = 0; j < numberOfNewChildren; j++) {
     assert(i+j < numberOfChildren());
     childAtIndex(i+j).setParentIdentifier(identifier());
@@ -126,6 +129,7 @@ void TreeHandle::swapChildrenInPlace(int i, int j) {
   TreeHandle secondChild = childAtIndex(secondChildIndex);
   TreePool::sharedPool()->move(firstChild.node()->nextSibling(), secondChild.node(), secondChild.numberOfChildren());
   TreePool::sharedPool()->move(childAtIndex(secondChildIndex).node()->nextSibling(), firstChild.node(), firstChild.numberOfChildren());
+  node()->invalidateStructuralHash();
 }
 
 #if POINCARE_TREE_LOG
@@ -156,6 +160,7 @@ void TreeHandle::addChildAtIndexInPlace(TreeHandle t, int index, int currentNumb
   t.node()->retain();
   node()->incrementNumberOfChildren();
   t.setParentIdentifier(identifier());
+  node()->invalidateStructuralHash();
 
   node()->didAddChildAtIndex(currentNumberOfChildren+1);
 }
@@ -175,12 +180,14 @@ void TreeHandle::removeChildInPlace(TreeHandle t, int childNumberOfChildren) {
   t.node()->release(childNumberOfChildren);
   t.deleteParentIdentifier();
   node()->decrementNumberOfChildren();
+  node()->invalidateStructuralHash();
 }
 
 void TreeHandle::removeChildrenInPlace(int currentNumberOfChildren) {
   assert(!isUninitialized());
   deleteParentIdentifierInChildren();
   TreePool::sharedPool()->removeChildren(node(), currentNumberOfChildren);
+  node()->invalidateStructuralHash();
 }
 
 /* Private */
@@ -1,6 +1,7 @@
 #include <poincare/tree_node.h>
 #include <poincare/tree_pool.h>
 #include <poincare/tree_handle.h>
+#include <string.h>
 
 namespace Poincare {
 
@@ -27,6 +28,45 @@ void TreeNode::rename(uint16_t identifier, bool unregisterPreviousIdentifier) {
   updateParentIdentifierInChildren();
 }
 
+uint8_t TreeNode::cachedStructuralHash() const {
+  if (!IsValidIdentifier(m_identifier)) {
+    return NoStructuralHash;
+  }
+  return TreePool::sharedPool()->structuralHash(m_identifier);
+}
+
+void TreeNode::setCachedStructuralHash(uint8_t hash) const {
+  if (IsValidIdentifier(m_identifier)) {
+    TreePool::sharedPool()->setStructuralHash(m_identifier, hash);
+  }
+}
+
+void TreeNode::invalidateStructuralHash() {
+  /* A cached hash is only computed from the cached hashes of the children it
+   * depends on. Once we reach a node without cached hash, the hashes of its
+   * ancestors cannot depend on the modified subtree anymore. */
+  TreeNode * node = this;
+  while (node != nullptr && node->cachedStructuralHash() != NoStructuralHash) {
+    node->setCachedStructuralHash(NoStructuralHash);
+    node = node->parent();
+  }
+}
+
+bool TreeNode::hasSameContentAs(const TreeNode * node) const {
+  size_t nodeSize = size();
+  if (node->size() != nodeSize) {
+    return false;
+  }
+  const char * thisBytes = reinterpret_cast<const char *>(this);
+  const char * nodeBytes = reinterpret_cast<const char *>(node);
+  // The virtual table pointer precedes the identifiers
+  size_t headerStart = reinterpret_cast<const char *>(&m_identifier) - thisBytes;
+  size_t headerEnd = reinterpret_cast<const char *>(&m_referenceCounter) + sizeof(m_referenceCounter) - thisBytes;
+  assert(headerEnd <= nodeSize);
+  return memcmp(thisBytes, nodeBytes, headerStart) == 0
+    && memcmp(thisBytes + headerEnd, nodeBytes + headerEnd, nodeSize - headerEnd) == 0;
+}
+
 // Hierarchy
 
 TreeNode * TreeNode::parent() const {
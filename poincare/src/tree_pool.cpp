@@ -16,6 +16,7 @@ TreePool * TreePool::SharedStaticPool = nullptr;
 void TreePool::freeIdentifier(uint16_t identifier) {
   if (TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes) {
     m_nodeForIdentifierOffset[identifier] = UINT16_MAX;
+    m_structuralHashes[identifier] = TreeNode::NoStructuralHash;
     m_identifiers.push(identifier);
   }
 }
@@ -117,6 +118,9 @@ void * TreePool::alloc(size_t size) {
   if (m_cursor + size > buffer() + BufferSize) {
     ExceptionCheckpoint::Raise();
   }
+  /* Nodes do not initialize their padding. The pool memory past the cursor is
+   * kept cleared, starting from the zero-initialized static pool, so that the
+   * content of identical nodes can be compared byte per byte. */
   void * result = m_cursor;
   m_cursor += size;
   return result;
@@ -134,6 +138,7 @@ void TreePool::dealloc(TreeNode * node, size_t size) {
     m_cursor - (ptr + size)
   );
   m_cursor -= size;
+  memset(m_cursor, 0, size);
 
   // Step 2: Update m_nodeForIdentifierOffset for all nodes downstream
   updateNodeForIdentifierFromNode(node);
@@ -177,6 +182,7 @@ void TreePool::freePoolFromNode(TreeNode * firstNodeToDiscard) {
     currentNode = currentNode->next();
   }
   m_cursor = reinterpret_cast<char *>(firstNodeToDiscard);
+  memset(m_cursor, 0, reinterpret_cast<char *>(lastNode) - m_cursor);
 }
 
 }
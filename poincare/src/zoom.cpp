@@ -337,16 +337,40 @@ void Zoom::RangeWithRatioForDisplay(ValueAtAbscissa evaluation, float yxRatio, f
 }
 
 void Zoom::FullRange(ValueAtAbscissa evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary) {
+  struct SingleEvaluation {
+    ValueAtAbscissa evaluation;
+    const void * auxiliary;
+  };
+  const SingleEvaluation single = { evaluation, auxiliary };
+  ValuesAtAbscissae evaluations = [](const float * abscissae, float * values, int numberOfValues, Context * context, const void * auxiliary) {
+    const SingleEvaluation * single = static_cast<const SingleEvaluation *>(auxiliary);
+    for (int i = 0; i < numberOfValues; i++) {
+      values[i] = single->evaluation(abscissae[i], context, single->auxiliary);
+    }
+  };
+  FullRange(evaluations, tMin, tMax, tStep, fMin, fMax, context, &single);
+}
+
+void Zoom::FullRange(ValuesAtAbscissae evaluation, float tMin, float tMax, float tStep, float * fMin, float * fMax, Context * context, const void * auxiliary) {
+  constexpr int k_numberOfValuesPerEvaluation = 16;
+  float abscissae[k_numberOfValuesPerEvaluation];
+  float values[k_numberOfValuesPerEvaluation];
   float t = tMin;
   *fMin = FLT_MAX;
   *fMax = -FLT_MAX;
   while (t <= tMax) {
-    float value = evaluation(t, context, auxiliary);
-    if (std::isfinite(value)) {
-      *fMin = std::min(*fMin, value);
-      *fMax = std::max(*fMax, value);
+    int numberOfValues = 0;
+    while (numberOfValues < k_numberOfValuesPerEvaluation && t <= tMax) {
+      abscissae[numberOfValues++] = t;
+      t += tStep;
+    }
+    evaluation(abscissae, values, numberOfValues, context, auxiliary);
+    for (int i = 0; i < numberOfValues; i++) {
+      if (std::isfinite(values[i])) {
+        *fMin = std::min(*fMin, values[i]);
+        *fMax = std::max(*fMax, values[i]);
+      }
     }
-    t += tStep;
   }
   if (*fMin > *fMax) {
     *fMin = NAN;
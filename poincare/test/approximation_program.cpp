@@ -0,0 +1,88 @@
+#include <poincare/approximation_program.h>
+#include <apps/shared/global_context.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+template<typename T>
+bool program_agrees_with_tree(const ApproximationProgram & program, Expression e, T x, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  T treeValue = e.approximateWithValueForSymbol<T>("x", x, context, complexFormat, angleUnit);
+  T programValue = program.approximateWithValueForSymbol<T>(x);
+  if (std::isnan(treeValue) || std::isnan(programValue)) {
+    return std::isnan(treeValue) && std::isnan(programValue);
+  }
+  /* Constants are approximated once in double precision, float programs might
+   * round them differently than the tree. Programs also compute real values
+   * with the real std functions, which may round differently than the complex
+   * ones used by the tree. */
+  return programValue == treeValue || IsApproximatelyEqual(programValue, treeValue, sizeof(T) == sizeof(float) ? 1E-5 : 1E-13, 0.0);
+}
+
+template<typename T>
+void assert_batch_agrees_with_program(const ApproximationProgram & program, const char * expression) {
+  constexpr int numberOfValues = 37;
+  T x[numberOfValues];
+  T results[numberOfValues];
+  for (int i = 0; i < numberOfValues; i++) {
+    x[i] = static_cast<T>(-4.5 + 0.25 * i);
+  }
+  program.approximateWithValuesForSymbol(x, results, numberOfValues);
+  for (int i = 0; i < numberOfValues; i++) {
+    T value = program.approximateWithValueForSymbol(x[i]);
+    quiz_assert_print_if_failure(results[i] == value || (std::isnan(results[i]) && std::isnan(value)), expression);
+  }
+}
+
+void assert_program_agrees_with_tree(const char * expression, bool compiles = true, Preferences::ComplexFormat complexFormat = Real, Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext globalContext;
+  Expression e = parse_expression(expression, &globalContext, false);
+  e = e.simplify(ExpressionNode::ReductionContext(&globalContext, complexFormat, angleUnit, Metric, SystemForApproximation));
+  ApproximationProgram program;
+  bool compiled = program.compile(e, "x", &globalContext, complexFormat, angleUnit);
+  quiz_assert_print_if_failure(compiled == compiles, expression);
+  if (!compiled) {
+    return;
+  }
+  const double values[] = {-3.0, -1.0, -0.5, 0.0, 0.25, 1.0, 2.0, 7.5, 1E10, -INFINITY, NAN};
+  for (double x : values) {
+    quiz_assert_print_if_failure(program_agrees_with_tree<double>(program, e, x, &globalContext, complexFormat, angleUnit), expression);
+    quiz_assert_print_if_failure(program_agrees_with_tree<float>(program, e, static_cast<float>(x), &globalContext, complexFormat, angleUnit), expression);
+  }
+  assert_batch_agrees_with_program<double>(program, expression);
+  assert_batch_agrees_with_program<float>(program, expression);
+}
+
+QUIZ_CASE(poincare_approximation_program_agrees_with_tree) {
+  assert_program_agrees_with_tree("x");
+  assert_program_agrees_with_tree("3x^2-2x+1");
+  assert_program_agrees_with_tree("1/x");
+  assert_program_agrees_with_tree("(x+1)/(x-1)");
+  assert_program_agrees_with_tree("√(x)");
+  assert_program_agrees_with_tree("√(x)", true, Cartesian);
+  assert_program_agrees_with_tree("x^(1/3)");
+  assert_program_agrees_with_tree("x^(2/3)");
+  assert_program_agrees_with_tree("x^(2/3)", true, Cartesian);
+  assert_program_agrees_with_tree("x^x");
+  assert_program_agrees_with_tree("ℯ^(-x^2/2)/√(2π)");
+  assert_program_agrees_with_tree("ln(x)+ln(2)");
+  assert_program_agrees_with_tree("log(x)");
+  assert_program_agrees_with_tree("log(x,2)+log(3,x)");
+  assert_program_agrees_with_tree("sin(x)cos(2x)+tan(x/3)");
+  assert_program_agrees_with_tree("sin(x)+cos(x)", true, Real, Degree);
+  assert_program_agrees_with_tree("acos(x)+asin(x)+atan(x)", true, Cartesian, Gradian);
+  assert_program_agrees_with_tree("abs(x-2)-x");
+  assert_program_agrees_with_tree("2𝐢x", true, Cartesian);
+  assert_program_agrees_with_tree("abs(𝐢x)", true, Cartesian);
+  assert_program_agrees_with_tree("abs(x)", true, Polar);
+}
+
+QUIZ_CASE(poincare_approximation_program_fallback) {
+  // These expressions are approximated by the tree
+  assert_program_agrees_with_tree("random()+x", false);
+  assert_program_agrees_with_tree("x+y", false);
+  assert_program_agrees_with_tree("floor(x)", false);
+  assert_program_agrees_with_tree("[[x,1]]", false);
+  assert_program_agrees_with_tree("int(t,t,0,x)", false);
+  // Too large for a program
+  assert_program_agrees_with_tree("sin(x+1)+sin(x+2)+sin(x+3)+sin(x+4)+sin(x+5)+sin(x+6)+sin(x+7)+sin(x+8)+sin(x+9)", false);
+}
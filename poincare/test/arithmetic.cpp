@@ -93,4 +93,10 @@ QUIZ_CASE(poincare_arithmetic_factorization) {
   int factors3[7] = {3,7,11, 13, 19, 3607, 3803};
   int coefficients3[7] = {4,2,2,2,2,2,2};
   assert_prime_factorization_equals_to(Integer("5513219850886344455940081"), factors3, coefficients3, 7);
+  int factors4[2] = {998244353, 1000000007};
+  int coefficients4[2] = {1, 1};
+  assert_prime_factorization_equals_to(Integer("998244359987710471"), factors4, coefficients4, 2);
+  int factors5[3] = {2, 10007, 10009};
+  int coefficients5[3] = {1, 2, 1};
+  assert_prime_factorization_equals_to(Integer("2004603500882"), factors5, coefficients5, 3);
 }
@@ -219,3 +219,28 @@ QUIZ_CASE(poincare_expression_order_addition_multiplication) {
     assert_multiplication_or_addition_is_ordered_as(e1, e2);
   }
 }
+
+QUIZ_CASE(poincare_expression_order_identical) {
+  // x^1 and x have the same order
+  quiz_assert(Power::Builder(Symbol::Builder('x'), Rational::Builder(1)).isIdenticalTo(Symbol::Builder('x')));
+  // A single-operand multiplication has the same order as its operand
+  quiz_assert(Multiplication::Builder(Addition::Builder(Symbol::Builder('x'))).isIdenticalTo(Symbol::Builder('x')));
+  // Functions are only ordered by name
+  quiz_assert(Function::Builder("f", 1, Rational::Builder(1)).isIdenticalTo(Function::Builder("f", 1, Rational::Builder(2))));
+  quiz_assert(!Function::Builder("f", 1, Rational::Builder(1)).isIdenticalTo(Function::Builder("g", 1, Rational::Builder(1))));
+
+  // Modifying a subtree invalidates the cached structural hashes
+  Expression e1 = Multiplication::Builder(Addition::Builder(Symbol::Builder('x'), Rational::Builder(2)), Symbol::Builder('y'));
+  Expression e2 = Multiplication::Builder(Addition::Builder(Symbol::Builder('x'), Symbol::Builder('z')), Symbol::Builder('y'));
+  quiz_assert(!e1.isIdenticalTo(e2));
+  e2.childAtIndex(0).replaceChildAtIndexInPlace(1, Rational::Builder(2));
+  quiz_assert(e1.isIdenticalTo(e2));
+  static_cast<Multiplication &>(e2).addChildAtIndexInPlace(Symbol::Builder('z'), 2, 2);
+  quiz_assert(!e1.isIdenticalTo(e2));
+  static_cast<Multiplication &>(e1).addChildAtIndexInPlace(Symbol::Builder('z'), 0, 2);
+  quiz_assert(!e1.isIdenticalTo(e2));
+  e1.swapChildrenInPlace(0, 2);
+  quiz_assert(!e1.isIdenticalTo(e2));
+  e1.swapChildrenInPlace(0, 1);
+  quiz_assert(e1.isIdenticalTo(e2));
+}
@@ -76,6 +76,9 @@ QUIZ_CASE(poincare_integer_properties) {
   quiz_assert(!Integer(2).isNegative());
   quiz_assert(Integer(-2).isNegative());
   quiz_assert(Integer::NumberOfBase10DigitsWithoutSign(MaxInteger()) == 309);
+  quiz_assert(Integer::NumberOfBase10DigitsWithoutSign(Integer(0)) == 1);
+  quiz_assert(Integer::NumberOfBase10DigitsWithoutSign(Integer(10000)) == 5);
+  quiz_assert(Integer::NumberOfBase10DigitsWithoutSign(Integer("100000000000000000000")) == 21);
 }
 
 static inline void assert_add_to(const Integer i, const Integer j, const Integer k) {
@@ -155,6 +158,11 @@ QUIZ_CASE(poincare_integer_multiplication) {
   assert_mult_to(Integer("-23456787654567765456"), Integer("0"), Integer("0"));
   assert_mult_to(Integer("3293920983030066"), Integer(720), Integer("2371623107781647520"));
   assert_mult_to(Integer("389282362616"), Integer(720), Integer("280283301083520"));
+  // Karatsuba multiplication
+  assert_mult_to(Integer("369988485035126972924700782451696644186473100389722973815184405301760594"), Integer("3234476509624757991344647769100216810857203198904625400933895331391691459637915714322"), Integer("1196719063677769496488418904688405141810258714500328913846267694101387384598423962022526413519336184929179664549451199691249988312088017850794019285741027268"));
+  assert_mult_to(Integer("-136891479058588375991326027382088315966463695625337436471480190078368997177499076593800206155688941388250484440597994042813512732765695774566001"), Integer("62230152778611417071440640537801242405902521687211671331011166147896988340353834411839448231257136169569665895551224821247160434722900390625"), Integer("-8518777655906040038186305763991214458837028562143689465992469772838254635115793928422684076009549346615026479614416262213403110575417964107843215411259498666821027539659099652611749036516550621124991527117581750916326651649667097106883350610996574747701970409252680838108062744140625"));
+  quiz_assert(Integer::Multiplication(MaxInteger(), Integer(2)).isOverflow());
+  quiz_assert(Integer::Multiplication(Integer("136891479058588375991326027382088315966463695625337436471480190078368997177499076593800206155688941388250484440597994042813512732765695774566001"), Integer("13689147905858837599132602738208831596646369562533743647148019007836899717749907659380020615568894138825048444059799404281351273276569577456600113689147905858837599132602738208831596646369562533743647148019007836899717749907659380020615568894138825048444059799404281351273276569577456600")).isOverflow());
 }
 
 static inline void assert_div_to(const Integer i, const Integer j, const Integer q, const Integer r) {
@@ -185,6 +193,8 @@ QUIZ_CASE(poincare_integer_divide) {
   assert_div_to(Integer("2305843009213693952"), Integer("2305843009213693921"), Integer("1"), Integer("31"));
   assert_div_to(MaxInteger(), MaxInteger(), Integer(1), Integer(0));
   assert_div_to(Integer("18446744073709551615"), Integer(10), Integer("1844674407370955161"), Integer(5));
+  assert_div_to(Integer("1196719063677769496488418904688405141810258714500328913846267694101387384598423962022526413519336184929179664549451199691249988312088017850794019285741027273"), Integer("3234476509624757991344647769100216810857203198904625400933895331391691459637915714322"), Integer("369988485035126972924700782451696644186473100389722973815184405301760594"), Integer(5));
+  assert_div_to(Integer("1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000017"), Integer(65521), Integer("15262282321698386776758596480517696616352009279467651592619160269226660154759542742021641916332168312449443689809374093801987149158285129958333969"), Integer(17168));
   assert_div_to(MaxInteger(), Integer(10), Integer("17976931348623159077293051907890247336179769789423065727343008115773267580550096313270847732240753602112011387987139335765878976881441662249284743063947412437776789342486548527630221960124609411945308295208500576883815068234246288147391311054082723716335051068458629823994724593847971630483535632962422413721"), Integer(5));
 }
 
@@ -194,6 +204,12 @@ static inline void assert_pow_to(const Integer i, const Integer j, const Integer
 
 QUIZ_CASE(poincare_integer_pow) {
   assert_pow_to(Integer(2), Integer(2), Integer(4));
+  assert_pow_to(Integer(-2), Integer(3), Integer(-8));
+  assert_pow_to(Integer(7), Integer(0), Integer(1));
+  assert_pow_to(Integer(3), Integer(300), Integer("136891479058588375991326027382088315966463695625337436471480190078368997177499076593800206155688941388250484440597994042813512732765695774566001"));
+  assert_pow_to(Integer(2), Integer(1000), Integer("10715086071862673209484250490600018105614048117055336074437503883703510511249361224931983788156958581275946729175531468251871452856923140435984577574698574803934567774824230985421074605062371141877954182153046474983581941267398767559165543946077062914571196477686542167660429831652624386837205668069376"));
+  quiz_assert(Integer::Power(Integer(2), Integer(1024)).isOverflow());
+  quiz_assert(Integer::Power(Integer(-1), Integer("12345678910111213141516")).isOne());
   assert_pow_to(Integer("12345678910111213141516171819202122232425"), Integer(2), Integer("152415787751564791571474464067365843004067618915106260955633159458990465721380625"));
 }
 
@@ -274,6 +290,9 @@ QUIZ_CASE(poincare_integer_serialize) {
   assert_integer_serializes_to(Integer(9131), "0x23AB", Integer::Base::Hexadecimal);
   assert_integer_serializes_to(Integer(123), "123", Integer::Base::Decimal);
   assert_integer_serializes_to(Integer("-2345678909876"), "-2345678909876");
+  assert_integer_serializes_to(Integer("100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001"), "100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001");
+  assert_integer_serializes_to(Integer("-10000"), "-10000");
+  assert_integer_serializes_to(Integer(0), "0");
   assert_integer_serializes_to(MaxInteger(), MaxIntegerString());
   assert_integer_serializes_to(OverflowedInteger(), Infinity::Name());
 }
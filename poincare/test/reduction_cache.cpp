@@ -0,0 +1,57 @@
+#include <poincare/reduction_cache.h>
+#include <apps/shared/global_context.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+static Expression reduce_with_cache(const char * expression, bool cacheEnabled, ExpressionNode::ReductionContext reductionContext) {
+  ReductionCache * cache = ReductionCache::sharedCache();
+  bool wasEnabled = cache->isEnabled();
+  cache->setEnabled(cacheEnabled);
+  Expression e = parse_expression(expression, reductionContext.context(), false);
+  e = e.reduce(reductionContext);
+  cache->setEnabled(wasEnabled);
+  return e;
+}
+
+void assert_reduction_is_memoized(const char * expression, bool memoizable = true, Preferences::AngleUnit angleUnit = Radian, Preferences::ComplexFormat complexFormat = Cartesian) {
+  Shared::GlobalContext globalContext;
+  ExpressionNode::ReductionContext reductionContext(&globalContext, complexFormat, angleUnit, Metric, User);
+  ReductionCache * cache = ReductionCache::sharedCache();
+  cache->clear();
+  Expression withoutCache = reduce_with_cache(expression, false, reductionContext);
+  quiz_assert(cache->numberOfHits() == 0 && cache->numberOfMisses() == 0);
+  Expression firstReduction = reduce_with_cache(expression, true, reductionContext);
+  Expression secondReduction = reduce_with_cache(expression, true, reductionContext);
+  quiz_assert_print_if_failure(cache->numberOfHits() == (memoizable ? 1 : 0), expression);
+  quiz_assert_print_if_failure(ReductionCache::TreesHaveSameContent(withoutCache, firstReduction), expression);
+  quiz_assert_print_if_failure(ReductionCache::TreesHaveSameContent(withoutCache, secondReduction), expression);
+}
+
+QUIZ_CASE(poincare_reduction_cache_identical_results) {
+  assert_reduction_is_memoized("2^100");
+  assert_reduction_is_memoized("1/3+2/7-π");
+  assert_reduction_is_memoized("√(12)×cos(π/6)");
+  assert_reduction_is_memoized("ln(2)+ln(3)", true, Degree);
+  assert_reduction_is_memoized("(1+2𝐢)^3", true, Radian, Polar);
+  assert_reduction_is_memoized("3_km+5_m");
+  assert_reduction_is_memoized("[[1,2][3,4]]^(-1)");
+  assert_reduction_is_memoized("1.5×10^(-3)+0.25");
+  // Symbols depend on the context and random numbers must be drawn again
+  assert_reduction_is_memoized("x^2+3x", false);
+  assert_reduction_is_memoized("f(2)", false);
+  assert_reduction_is_memoized("random()+1", false);
+}
+
+QUIZ_CASE(poincare_reduction_cache_reduction_context) {
+  Shared::GlobalContext globalContext;
+  ReductionCache * cache = ReductionCache::sharedCache();
+  cache->clear();
+  reduce_with_cache("cos(1)", true, ExpressionNode::ReductionContext(&globalContext, Cartesian, Radian, Metric, User));
+  reduce_with_cache("cos(1)", true, ExpressionNode::ReductionContext(&globalContext, Cartesian, Degree, Metric, User));
+  quiz_assert(cache->numberOfHits() == 0 && cache->numberOfMisses() == 2);
+  // A different input of the same shape is a miss
+  reduce_with_cache("cos(2)", true, ExpressionNode::ReductionContext(&globalContext, Cartesian, Radian, Metric, User));
+  quiz_assert(cache->numberOfHits() == 0 && cache->numberOfMisses() == 3);
+  cache->clear();
+}
@@ -611,9 +611,7 @@ QUIZ_CASE(poincare_simplification_power) {
    * k_maxNumberOfPrimeFactors and thus it prime decomposition might overflow
    * 32 factors. */
   assert_parsed_expression_simplify_to("1881676377434183981909562699940347954480361860897069^(1/3)", "root(1881676377434183981909562699940347954480361860897069,3)");
-  /* This does not reduce but should not as the prime decomposition involves
-   * factors above k_maxNumberOfPrimeFactors. */
-  assert_parsed_expression_simplify_to("1002101470343^(1/3)", "root(1002101470343,3)");
+  assert_parsed_expression_simplify_to("1002101470343^(1/3)", "10007");
   assert_parsed_expression_simplify_to("π×π×π", "π^3");
   assert_parsed_expression_simplify_to("(x+π)^(3)", "x^3+3×π×x^2+3×π^2×x+π^3");
   assert_parsed_expression_simplify_to("(5+√(2))^(-8)", "\u0012-1003320×√(2)+1446241\u0013/78310985281");
@@ -670,9 +668,7 @@ QUIZ_CASE(poincare_simplification_logarithm) {
   assert_parsed_expression_simplify_to("log((23π)^4,23π)", "4");
   assert_parsed_expression_simplify_to("log(10^(2+π))", "π+2");
   assert_parsed_expression_simplify_to("ln(1881676377434183981909562699940347954480361860897069)", "ln(1881676377434183981909562699940347954480361860897069)");
-  /* log(1002101470343) does no reduce to 3×log(10007) because it involves
-   * prime factors above k_biggestPrimeFactor */
-  assert_parsed_expression_simplify_to("log(1002101470343)", "log(1002101470343)");
+  assert_parsed_expression_simplify_to("log(1002101470343)", "3×log(10007)");
   assert_parsed_expression_simplify_to("log(64,2)", "6");
   assert_parsed_expression_simplify_to("log(2,64)", "log(2,64)");
   assert_parsed_expression_simplify_to("log(1476225,5)", "10×log(3,5)+2");
@@ -738,7 +734,11 @@ QUIZ_CASE(poincare_simplification_function) {
   assert_parsed_expression_simplify_to("factor(-10008/6895)", "-\u00122^3×3^2×139\u0013/\u00125×7×197\u0013");
   assert_parsed_expression_simplify_to("factor(1008/6895)", "\u00122^4×3^2\u0013/\u00125×197\u0013");
   assert_parsed_expression_simplify_to("factor(10007)", "10007");
-  assert_parsed_expression_simplify_to("factor(10007^2)", Undefined::Name());
+  assert_parsed_expression_simplify_to("factor(10007^2)", "10007^2");
+  assert_parsed_expression_simplify_to("factor(998244359987710471)", "998244353×1000000007");
+  assert_parsed_expression_simplify_to("factor(18446743979220271189)", "4294967279×4294967291");
+  assert_parsed_expression_simplify_to("factor(18446744073709551557)", "18446744073709551557");
+  assert_parsed_expression_simplify_to("factor(2×3×10007^4)", "2×3×10007^4");
   assert_parsed_expression_simplify_to("factor(𝐢)", Undefined::Name());
   assert_parsed_expression_simplify_to("floor(-1.3)", "-2");
   assert_parsed_expression_simplify_to("floor(2π)", "6");
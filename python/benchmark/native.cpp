@@ -0,0 +1,31 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include "../test/execution_environment.h"
+#include <string.h>
+
+static void time_mandelbrot(bool native) {
+  constexpr const char * definition = "def mandelbrot";
+  const char * content = Code::ScriptTemplate::Mandelbrot()->content();
+  const char * definitionStart = strstr(content, definition);
+  quiz_assert(definitionStart != nullptr);
+  constexpr int bufferSize = 1000;
+  char script[bufferSize];
+  int length = definitionStart - content;
+  quiz_assert(length < bufferSize);
+  strlcpy(script, content, length + 1);
+  if (native) {
+    length += strlcpy(script + length, "@micropython.native\n", bufferSize - length);
+  }
+  length += strlcpy(script + length, definitionStart, bufferSize - length);
+  strlcpy(script + length, "\nmandelbrot(15)", bufferSize - length);
+  uint64_t startTime = quiz_stopwatch_start();
+  assert_script_execution_succeeds(script);
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(python_native_code_benchmark) {
+  // The Mandelbrot(15) scenario of the events benchmark, without the UI
+  quiz_print("Bytecode, then native");
+  time_mandelbrot(false);
+  time_mandelbrot(true);
+}
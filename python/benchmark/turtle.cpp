@@ -0,0 +1,27 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include "../test/execution_environment.h"
+
+static void time_spirograph(bool tracing) {
+  const char * script = tracing ?
+    R"(from turtle import *
+speed(0)
+for i in range(360):
+  circle(50)
+  left(1))" :
+    R"(from turtle import *
+tracer(0)
+for i in range(360):
+  circle(50)
+  left(1)
+update())";
+  uint64_t startTime = quiz_stopwatch_start();
+  assert_script_execution_succeeds(script);
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(python_turtle_tracer_benchmark) {
+  // A spirograph, of 360 circles, at the highest speed then without tracing
+  time_spirograph(true);
+  time_spirograph(false);
+}
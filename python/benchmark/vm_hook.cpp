@@ -0,0 +1,21 @@
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+#include "../test/execution_environment.h"
+#include <ion.h>
+
+QUIZ_CASE(python_vm_hook_benchmark) {
+  // A tight loop, which counts the hook down at each iteration
+  quiz_print("2000000 empty iterations");
+  uint64_t startTime = quiz_stopwatch_start();
+  assert_script_execution_succeeds("for i in range(2000000): pass");
+  quiz_stopwatch_print_lap(startTime);
+  // The cost of reading the clock at each iteration
+  quiz_print("2000000 clock readings");
+  startTime = quiz_stopwatch_start();
+  uint64_t t = 0;
+  for (int i = 0; i < 2000000; i++) {
+    t += Ion::Timing::millis();
+  }
+  quiz_assert(t > 0);
+  quiz_stopwatch_print_lap(startTime);
+}
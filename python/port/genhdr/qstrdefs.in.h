@@ -139,6 +139,7 @@ Q(bound_method)
 Q(builtins)
 Q(bytecode)
 Q(bytes)
+Q(bytearray)
 Q(callable)
 Q(ceil)
 Q(choice)
@@ -382,6 +383,9 @@ Q(large_font)
 Q(small_font)
 Q(wait_vblank)
 Q(get_keys)
+Q(blit)
+Q(grab)
+Q(fill_rects)
 
 // Keys QSTRs
 Q(left)
@@ -493,6 +497,8 @@ Q(hideturtle)
 Q(ht)
 Q(isvisible)
 Q(colormode)
+Q(tracer)
+Q(update)
 
 // utime QSTRs
 Q(localtime)
@@ -547,3 +553,40 @@ Q(username)
 Q(rename)
 Q(listdir)
 
+// numpy QSTRs
+Q(numpy)
+Q(ndarray)
+Q(array)
+Q(zeros)
+Q(ones)
+Q(linspace)
+Q(arange)
+Q(sin)
+Q(cos)
+Q(tan)
+Q(exp)
+Q(log)
+Q(sqrt)
+Q(sum)
+Q(mean)
+Q(std)
+Q(min)
+Q(max)
+Q(sort)
+Q(copy)
+Q(tolist)
+Q(pi)
+Q(e)
+Q(__radd__)
+Q(__rsub__)
+
+// Native code emitter QSTRs
+Q(None)
+Q(native)
+Q(viper)
+Q(ViperTypeError)
+Q(ptr)
+Q(ptr8)
+Q(ptr16)
+Q(ptr32)
+Q(uint)
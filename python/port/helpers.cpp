@@ -5,26 +5,58 @@ extern "C" {
 #include "mphalport.h"
 }
 
+/* Doing too many things in the VM hook slows down Python execution quite a
+ * lot. So we only do things once in a while and return as soon as possible
+ * otherwise. */
+static constexpr uint64_t k_hookDelay = 100;
+static uint64_t sLastHookTime = 0;
+
+static bool hookIfDelayElapsed(uint64_t t) {
+  if (t - sLastHookTime < k_hookDelay) {
+    return false;
+  }
+  sLastHookTime = t;
+  micropython_port_vm_hook_refresh_print();
+  // Check if the user asked for an interruption from the keyboard
+  return micropython_port_interrupt_if_needed();
+}
+
 bool micropython_port_vm_hook_loop() {
-  /* This function is called very frequently by the MicroPython engine. We grab
+  /* This function is called by the modules which block for a while. We grab
    * this opportunity to interrupt execution and/or refresh the display on
    * platforms that need it. */
+  return hookIfDelayElapsed(Ion::Timing::millis());
+}
 
-  /* Doing too many things here slows down Python execution quite a lot. So we
-   * only do things once in a while and return as soon as possible otherwise. */
-
-  static uint64_t t = Ion::Timing::millis();
-  static constexpr uint64_t delay = 100;
+/* Even reading the clock at each iteration of the innermost loops of Python
+ * takes a large share of their execution time. The VM thus only reads it once
+ * the countdown elapsed. The number of iterations between two readings
+ * doubles while they take less than half of k_clockReadingDelay, and falls
+ * back to 1 as soon as a reading is late. The maximum is kept low because a
+ * loop that suddenly slows down is only noticed at the next reading: after a
+ * tight loop, iterations of 20ms still read the clock within 320ms. */
+static constexpr uint64_t k_clockReadingDelay = 10;
+static constexpr int32_t k_maxNumberOfIterationsBetweenClockReadings = 16;
+static uint64_t sLastClockReadingTime = 0;
+int32_t micropython_port_vm_hook_countdown = 1;
+static int32_t sNumberOfIterationsBetweenClockReadings = 1;
 
-  uint64_t t2 = Ion::Timing::millis();
-  if (t2 - t < delay) {
-    return false;
+int32_t micropython_port_vm_hook_next_countdown(int32_t numberOfIterations, uint64_t elapsed) {
+  if (elapsed > k_clockReadingDelay) {
+    return 1;
+  }
+  if (2 * elapsed < k_clockReadingDelay && numberOfIterations < k_maxNumberOfIterationsBetweenClockReadings) {
+    return 2 * numberOfIterations;
   }
-  t = t2;
+  return numberOfIterations;
+}
 
-  micropython_port_vm_hook_refresh_print();
-  // Check if the user asked for an interruption from the keyboard
-  return micropython_port_interrupt_if_needed();
+bool micropython_port_vm_hook_countdown_elapsed() {
+  uint64_t t = Ion::Timing::millis();
+  sNumberOfIterationsBetweenClockReadings = micropython_port_vm_hook_next_countdown(sNumberOfIterationsBetweenClockReadings, t - sLastClockReadingTime);
+  sLastClockReadingTime = t;
+  micropython_port_vm_hook_countdown = sNumberOfIterationsBetweenClockReadings;
+  return hookIfDelayElapsed(t);
 }
 
 void micropython_port_vm_hook_refresh_print() {
@@ -6,14 +6,25 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // These methods return true if they have been interrupted
 bool micropython_port_vm_hook_loop();
+/* The VM calls micropython_port_vm_hook_countdown_elapsed once every
+ * micropython_port_vm_hook_countdown iterations of its loops. */
+extern int32_t micropython_port_vm_hook_countdown;
+bool micropython_port_vm_hook_countdown_elapsed();
+/* Return the countdown following numberOfIterations iterations that took
+ * elapsed milliseconds. */
+int32_t micropython_port_vm_hook_next_countdown(int32_t numberOfIterations, uint64_t elapsed);
 void micropython_port_vm_hook_refresh_print();
 bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
+// Allocate memory for native code, or raise an exception
+void micropython_port_alloc_exec(size_t min_size, void ** ptr, size_t * size);
+void micropython_port_free_exec(void * ptr, size_t size);
 
 #ifdef __cplusplus
 }
@@ -5,6 +5,8 @@ extern "C" {
 #include <kandinsky.h>
 #include <ion.h>
 #include "port.h"
+#include <assert.h>
+#include <string.h>
 
 
 static mp_obj_t TupleForKDColor(KDColor c) {
@@ -80,11 +82,11 @@ mp_obj_t modkandinsky_draw_line(size_t n_args, const mp_obj_t * args) {
   return mp_const_none;
 }
 
-mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
-  mp_int_t x = mp_obj_get_int(args[0]);
-  mp_int_t y = mp_obj_get_int(args[1]);
-  mp_int_t width = mp_obj_get_int(args[2]);
-  mp_int_t height = mp_obj_get_int(args[3]);
+static KDRect RectForArgs(mp_obj_t xArg, mp_obj_t yArg, mp_obj_t widthArg, mp_obj_t heightArg) {
+  mp_int_t x = mp_obj_get_int(xArg);
+  mp_int_t y = mp_obj_get_int(yArg);
+  mp_int_t width = mp_obj_get_int(widthArg);
+  mp_int_t height = mp_obj_get_int(heightArg);
   if (width < 0) {
     width = -width;
     x = x - width;
@@ -93,13 +95,178 @@ mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
     height = -height;
     y = y - height;
   }
-  KDRect rect(x, y, width, height);
+  return KDRect(x, y, width, height);
+}
+
+static KDRect RectForTuple(mp_obj_t tuple) {
+  mp_obj_t * coordinates;
+  mp_obj_get_array_fixed_n(tuple, 4, &coordinates);
+  return RectForArgs(coordinates[0], coordinates[1], coordinates[2], coordinates[3]);
+}
+
+mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
+  KDRect rect = RectForArgs(args[0], args[1], args[2], args[3]);
   KDColor color = MicroPython::Color::Parse(args[4]);
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
   KDIonContext::sharedContext()->fillRect(rect, color);
   return mp_const_none;
 }
 
+mp_obj_t modkandinsky_fill_rects(mp_obj_t rects, mp_obj_t color) {
+  size_t numberOfRects;
+  mp_obj_t * items;
+  mp_obj_get_array(rects, &numberOfRects, &items);
+  KDColor kdColor = MicroPython::Color::Parse(color);
+  for (size_t i = 0; i < numberOfRects; i++) {
+    RectForTuple(items[i]);
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  for (size_t i = 0; i < numberOfRects; i++) {
+    KDIonContext::sharedContext()->fillRect(RectForTuple(items[i]), kdColor);
+  }
+  return mp_const_none;
+}
+
+/* Sprites are buffers of RGB565 pixels, two bytes per pixel in the native
+ * byte order, or of 4 or 8-bit indexes in a palette of colors. Rows of 4-bit
+ * sprites start on a new byte, the first pixel being in the high nibble. */
+
+class Sprite {
+public:
+  Sprite(mp_obj_t buffer, KDCoordinate width, KDCoordinate height, int bitsPerPixel) :
+    m_width(width),
+    m_bitsPerPixel(bitsPerPixel),
+    m_paletteSize(0),
+    m_palette(nullptr)
+  {
+    mp_buffer_info_t bufferInfo;
+    mp_get_buffer_raise(buffer, &bufferInfo, MP_BUFFER_READ);
+    m_pixels = static_cast<const uint8_t *>(bufferInfo.buf);
+    m_rowLength = (width * bitsPerPixel + 7) / 8;
+    if (bufferInfo.len < m_rowLength * height) {
+      mp_raise_ValueError("buffer too small");
+    }
+  }
+  void setPalette(mp_obj_t palette, KDCoordinate height) {
+    mp_obj_t * colors;
+    mp_obj_get_array(palette, &m_paletteSize, &colors);
+    if (m_paletteSize > (1u << m_bitsPerPixel)) {
+      mp_raise_ValueError("too many colors in palette");
+    }
+    // The parsed palette lives on the Python heap, not on the C stack
+    m_palette = m_new(KDColor, m_paletteSize);
+    for (size_t i = 0; i < m_paletteSize; i++) {
+      m_palette[i] = MicroPython::Color::Parse(colors[i]);
+    }
+    // Check the indexes before anything is drawn
+    for (KDCoordinate j = 0; j < height; j++) {
+      for (KDCoordinate i = 0; i < m_width; i++) {
+        if (index(i, j) >= m_paletteSize) {
+          mp_raise_ValueError("color index out of palette");
+        }
+      }
+    }
+  }
+  // RGB565 sprites whose pixels are aligned do not need to be converted
+  const KDColor * pixels() const {
+    return m_bitsPerPixel == 16 && reinterpret_cast<uintptr_t>(m_pixels) % alignof(KDColor) == 0 ? reinterpret_cast<const KDColor *>(m_pixels) : nullptr;
+  }
+  // Convert the numberOfPixels pixels of row j starting at column i
+  void convertRow(KDCoordinate j, KDCoordinate i, KDCoordinate numberOfPixels, KDColor * row) const {
+    if (m_bitsPerPixel == 16) {
+      memcpy(row, m_pixels + j * m_rowLength + i * sizeof(KDColor), numberOfPixels * sizeof(KDColor));
+      return;
+    }
+    for (KDCoordinate k = 0; k < numberOfPixels; k++) {
+      row[k] = m_palette[index(i + k, j)];
+    }
+  }
+private:
+  size_t index(KDCoordinate i, KDCoordinate j) const {
+    const uint8_t * row = m_pixels + j * m_rowLength;
+    if (m_bitsPerPixel == 8) {
+      return row[i];
+    }
+    assert(m_bitsPerPixel == 4);
+    return i % 2 == 0 ? row[i / 2] >> 4 : row[i / 2] & 0xF;
+  }
+  const uint8_t * m_pixels;
+  size_t m_rowLength;
+  KDCoordinate m_width;
+  int m_bitsPerPixel;
+  size_t m_paletteSize;
+  KDColor * m_palette;
+};
+
+static KDCoordinate SizeForArg(mp_obj_t sizeArg) {
+  mp_int_t size = mp_obj_get_int(sizeArg);
+  if (size < 0) {
+    mp_raise_ValueError("negative size");
+  }
+  if (size > KDCOORDINATE_MAX) {
+    mp_raise_ValueError("size too large");
+  }
+  return size;
+}
+
+mp_obj_t modkandinsky_blit(size_t n_args, const mp_obj_t * args) {
+  mp_int_t x = mp_obj_get_int(args[0]);
+  mp_int_t y = mp_obj_get_int(args[1]);
+  KDCoordinate width = SizeForArg(args[2]);
+  KDCoordinate height = SizeForArg(args[3]);
+  mp_int_t bitsPerPixel = n_args >= 7 ? mp_obj_get_int(args[6]) : (n_args >= 6 ? 8 : 16);
+  if (n_args >= 6 && bitsPerPixel != 4 && bitsPerPixel != 8) {
+    mp_raise_ValueError("bits must be 4 or 8");
+  }
+  Sprite sprite(args[4], width, height, bitsPerPixel);
+  if (n_args >= 6) {
+    sprite.setPalette(args[5], height);
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  KDIonContext * context = KDIonContext::sharedContext();
+  if (sprite.pixels() != nullptr) {
+    context->fillRectWithPixels(KDRect(x, y, width, height), sprite.pixels(), nullptr);
+    return mp_const_none;
+  }
+  if (width == 0 || height == 0) {
+    return mp_const_none;
+  }
+  /* Other sprites are converted by bands of rows, each pushed at once. The
+   * band holds one screen row so that it stays small on the stack. Rows wider
+   * than the band are split. */
+  constexpr int k_bandSize = Ion::Display::Width;
+  KDColor band[k_bandSize];
+  KDCoordinate bandWidth = width < k_bandSize ? width : k_bandSize;
+  KDCoordinate numberOfRowsPerBand = k_bandSize / bandWidth;
+  for (KDCoordinate j = 0; j < height; j += numberOfRowsPerBand) {
+    KDCoordinate numberOfRows = height - j < numberOfRowsPerBand ? height - j : numberOfRowsPerBand;
+    for (KDCoordinate i = 0; i < width; i += bandWidth) {
+      KDCoordinate numberOfColumns = width - i < bandWidth ? width - i : bandWidth;
+      for (KDCoordinate k = 0; k < numberOfRows; k++) {
+        sprite.convertRow(j + k, i, numberOfColumns, band + k * numberOfColumns);
+      }
+      // The band is its own working buffer if it is clipped
+      context->fillRectWithPixels(KDRect(x + i, y + j, numberOfColumns, numberOfRows), band, band);
+    }
+  }
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_grab(size_t n_args, const mp_obj_t * args) {
+  mp_int_t x = mp_obj_get_int(args[0]);
+  mp_int_t y = mp_obj_get_int(args[1]);
+  KDCoordinate width = SizeForArg(args[2]);
+  KDCoordinate height = SizeForArg(args[3]);
+  size_t numberOfPixels = width * height;
+  // Pixels out of the screen are black
+  KDColor * pixels = m_new(KDColor, numberOfPixels);
+  for (size_t i = 0; i < numberOfPixels; i++) {
+    pixels[i] = KDColorBlack;
+  }
+  KDIonContext::sharedContext()->getPixels(KDRect(x, y, width, height), pixels);
+  return mp_obj_new_bytearray_by_ref(sizeof(KDColor) * numberOfPixels, pixels);
+}
+
 mp_obj_t modkandinsky_wait_vblank() {
   micropython_port_interrupt_if_needed();
   Ion::Display::waitForVBlank();
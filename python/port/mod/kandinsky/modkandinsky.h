@@ -6,5 +6,8 @@ mp_obj_t modkandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t color);
 mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t *args);
 mp_obj_t modkandinsky_draw_line(size_t n_args, const mp_obj_t *args);
 mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_fill_rects(mp_obj_t rects, mp_obj_t color);
+mp_obj_t modkandinsky_blit(size_t n_args, const mp_obj_t *args);
+mp_obj_t modkandinsky_grab(size_t n_args, const mp_obj_t *args);
 mp_obj_t modkandinsky_wait_vblank();
 mp_obj_t modkandinsky_get_keys();
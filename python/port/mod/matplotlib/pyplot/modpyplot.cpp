@@ -1,5 +1,6 @@
 extern "C" {
 #include "modpyplot.h"
+#include "../../numpy/modnumpy.h"
 }
 #include <assert.h>
 #include <escher/palette.h>
@@ -18,6 +19,14 @@ static size_t extractArgument(mp_obj_t arg, mp_obj_t ** items) {
   size_t itemLength;
   if (mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
     mp_obj_get_array(arg, &itemLength, items);
+  } else if (mp_obj_is_type(arg, &modnumpy_ndarray_type)) {
+    // The items of numpy arrays are boxed, since the store keeps objects
+    const modnumpy_ndarray_t * array = static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(arg));
+    itemLength = array->length;
+    *items = m_new(mp_obj_t, itemLength);
+    for (size_t i = 0; i < itemLength; i++) {
+      (*items)[i] = mp_obj_new_float(modnumpy_ndarray_item(array, i));
+    }
   } else {
     itemLength = 1;
     *items = m_new(mp_obj_t, 1);
@@ -26,6 +35,43 @@ static size_t extractArgument(mp_obj_t arg, mp_obj_t ** items) {
   return itemLength;
 }
 
+// Length of a scalar or array argument
+
+static size_t argumentLength(mp_obj_t arg) {
+  if (mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
+    size_t itemLength;
+    mp_obj_t * items;
+    mp_obj_get_array(arg, &itemLength, &items);
+    return itemLength;
+  }
+  if (mp_obj_is_type(arg, &modnumpy_ndarray_type)) {
+    return static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(arg))->length;
+  }
+  return 1;
+}
+
+/* Write a scalar or array argument in a coordinate of points, which hold
+ * argumentLength(arg) elements. The items of numpy arrays are read directly,
+ * without being boxed. */
+
+static void extractCoordinates(mp_obj_t arg, Matplotlib::PlotStore::Point * points, float Matplotlib::PlotStore::Point::* coordinate) {
+  if (mp_obj_is_type(arg, &modnumpy_ndarray_type)) {
+    const modnumpy_ndarray_t * array = static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(arg));
+    for (size_t i = 0; i < array->length; i++) {
+      points[i].*coordinate = modnumpy_ndarray_item(array, i);
+    }
+  } else if (mp_obj_is_type(arg, &mp_type_tuple) || mp_obj_is_type(arg, &mp_type_list)) {
+    size_t itemLength;
+    mp_obj_t * items;
+    mp_obj_get_array(arg, &itemLength, &items);
+    for (size_t i = 0; i < itemLength; i++) {
+      points[i].*coordinate = mp_obj_get_float(items[i]);
+    }
+  } else {
+    points[0].*coordinate = mp_obj_get_float(arg);
+  }
+}
+
 // Extract two scalar or array arguments and check for their strickly equal dimension
 
 static size_t extractArgumentsAndCheckEqualSize(mp_obj_t x, mp_obj_t y, mp_obj_t ** xItems, mp_obj_t ** yItems) {
@@ -397,20 +443,23 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
   if (n_args > 3) {
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,"plot() takes 3 positional arguments but %d were given",n_args));
   }
-  mp_obj_t * xItems, * yItems;
-  size_t length;
-  if (n_args == 1) {
-    length = extractArgument(args[0], &yItems);
+  mp_obj_t yArg = args[n_args == 1 ? 0 : 1];
+  size_t length = argumentLength(yArg);
+  if (n_args >= 2 && argumentLength(args[0]) != length) {
+    mp_raise_ValueError("x and y must be the same size");
+  }
 
-    // Create the default xItems: [0, 1, 2,...]
-    xItems = m_new(mp_obj_t, length);
+  // Pack the coordinates before touching the store, in case they raise
+  Matplotlib::PlotStore::Point * points = m_new(Matplotlib::PlotStore::Point, length);
+  if (n_args == 1) {
+    // The default x are the indexes [0, 1, 2,...]
     for (size_t i = 0; i < length; i++) {
-      xItems[i] = mp_obj_new_float((float)i);
+      points[i].x = static_cast<float>(i);
     }
   } else {
-    assert(n_args >= 2);
-    length = extractArgumentsAndCheckEqualSize(args[0], args[1], &xItems, &yItems);
+    extractCoordinates(args[0], points, &Matplotlib::PlotStore::Point::x);
   }
+  extractCoordinates(yArg, points, &Matplotlib::PlotStore::Point::y);
 
   // Setting plot color
   KDColor color;
@@ -426,9 +475,7 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,mp_map_t* kw_args) {
     color = MicroPython::Color::Parse(args[2]);
   }
 
-  for (int i=0; i<(int)length-1; i++) {
-    sPlotStore->addSegment(xItems[i], yItems[i], xItems[i+1], yItems[i+1], color);
-  }
+  sPlotStore->addCurve(points, length, color);
 
   return mp_const_none;
 }
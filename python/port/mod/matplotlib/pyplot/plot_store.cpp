@@ -10,144 +10,96 @@ PlotStore::PlotStore() : Shared::InteractiveCurveViewRange(),
 }
 
 void PlotStore::flush() {
-  m_dots = mp_obj_new_list(0, nullptr);
-  m_segments = mp_obj_new_list(0, nullptr);
-  m_rects = mp_obj_new_list(0, nullptr);
-  m_labels = mp_obj_new_list(0, nullptr);
+  m_dots.init();
+  m_segments.init();
+  m_curves.init();
+  m_rects.init();
+  m_labels.init();
+  m_xMin = FLT_MAX;
+  m_xMax = -FLT_MAX;
+  m_yMin = FLT_MAX;
+  m_yMax = -FLT_MAX;
   m_axesRequested = true;
   m_axesAuto = true;
   m_gridRequested = false;
 }
 
-// Iterators
+// Array
 
 template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::Begin(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  return it;
-}
-
-template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::End(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  if (it.m_numberOfTuples > 0) {
-    it.m_tupleIndex = it.m_numberOfTuples;
+void PlotStore::Array<T>::append(const T & item) {
+  if (m_numberOfItems == m_capacity) {
+    size_t newCapacity = m_capacity == 0 ? 4 : 2 * m_capacity;
+    m_items = m_renew(T, m_items, m_capacity, newCapacity);
+    m_capacity = newCapacity;
   }
-  return it;
+  m_items[m_numberOfItems++] = item;
 }
 
-template <class T>
-PlotStore::ListIterator<T> & PlotStore::ListIterator<T>::operator++() {
-  if (m_tupleIndex < m_numberOfTuples) {
-    m_tupleIndex++;
-  }
-  return *this;
-}
-
-template <class T>
-bool PlotStore::ListIterator<T>::operator!=(const PlotStore::ListIterator<T> & it) const {
-  return m_tupleIndex != it.m_tupleIndex;
-};
-
-template <class T>
-T PlotStore::ListIterator<T>::operator*() {
-  return T(m_tuples[m_tupleIndex]);
-};
-
-
 // Dot
 
-template class PlotStore::ListIterator<PlotStore::Dot>;
-
-PlotStore::Dot::Dot(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[2]));
-}
+template class PlotStore::Array<PlotStore::Dot>;
 
 void PlotStore::addDot(mp_obj_t x, mp_obj_t y, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[3] = {x, y, color};
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_dots, tuple);
+  Dot dot(mp_obj_get_float(x), mp_obj_get_float(y), c);
+  m_dots.append(dot);
+  updateBounds(dot.x(), dot.y());
 }
 
 // Segment
 
-template class PlotStore::ListIterator<PlotStore::Segment>;
-
-PlotStore::Segment::Segment(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 6 , &elements);
-  m_xStart = mp_obj_get_float(elements[0]);
-  m_yStart = mp_obj_get_float(elements[1]);
-  m_xEnd = mp_obj_get_float(elements[2]);
-  m_yEnd = mp_obj_get_float(elements[3]);
-  m_arrowWidth = mp_obj_get_float(elements[4]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[5]));
-}
+template class PlotStore::Array<PlotStore::Segment>;
 
 void PlotStore::addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd, mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[6] = {xStart, yStart, xEnd, yEnd, arrowWidth, color};
-  mp_obj_t tuple = mp_obj_new_tuple(6, items);
-  mp_obj_list_append(m_segments, tuple);
+  Segment segment(mp_obj_get_float(xStart), mp_obj_get_float(yStart), mp_obj_get_float(xEnd), mp_obj_get_float(yEnd), mp_obj_get_float(arrowWidth), c);
+  m_segments.append(segment);
+  updateBounds(segment.xStart(), segment.yStart());
+  updateBounds(segment.xEnd(), segment.yEnd());
 }
 
-// Rect
+// Curve
 
-template class PlotStore::ListIterator<PlotStore::Rect>;
+template class PlotStore::Array<PlotStore::Curve>;
 
-PlotStore::Rect::Rect(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 5, &elements);
-  m_left = mp_obj_get_float(elements[0]);
-  m_right = mp_obj_get_float(elements[1]);
-  m_top = mp_obj_get_float(elements[2]);
-  m_bottom = mp_obj_get_float(elements[3]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[4]));
+void PlotStore::addCurve(const Point * points, size_t numberOfPoints, KDColor c) {
+  m_curves.append(Curve(points, numberOfPoints, c));
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    updateBounds(points[i].x, points[i].y);
+  }
 }
 
+// Rect
+
+template class PlotStore::Array<PlotStore::Rect>;
+
 void PlotStore::addRect(mp_obj_t left, mp_obj_t right, mp_obj_t top, mp_obj_t bottom, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[5] = {left, right, top, bottom, color};
-  mp_obj_t tuple = mp_obj_new_tuple(5, items);
-  mp_obj_list_append(m_rects, tuple);
+  Rect rect(mp_obj_get_float(left), mp_obj_get_float(right), mp_obj_get_float(top), mp_obj_get_float(bottom), c);
+  m_rects.append(rect);
+  updateBounds(rect.left(), rect.top());
+  updateBounds(rect.right(), rect.bottom());
 }
 
 // Label
 
-template class PlotStore::ListIterator<PlotStore::Label>;
-
-PlotStore::Label::Label(mp_obj_t tuple) {
-  mp_obj_t * elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_string = mp_obj_str_get_str(elements[2]);
-}
+template class PlotStore::Array<PlotStore::Label>;
 
 void PlotStore::addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string) {
-  mp_obj_t items[3] = {x, y, string};
   if (!mp_obj_is_str(string)) {
     mp_raise_TypeError("argument should be a string");
   }
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_labels, tuple);
+  Label label(mp_obj_get_float(x), mp_obj_get_float(y), string);
+  m_labels.append(label);
+  updateBounds(label.x(), label.y());
 }
 
 // Axes
 
-void updateRange(float * xMin, float * xMax, float * yMin, float * yMax, float x, float y) {
+void PlotStore::updateBounds(float x, float y) {
   if (!std::isnan(x) && !std::isinf(x) && !std::isnan(y) && !std::isinf(y)) {
-    *xMin = std::min(*xMin, x);
-    *xMax = std::max(*xMax, x);
-    *yMin = std::min(*yMin, y);
-    *yMax = std::max(*yMax, y);
+    m_xMin = std::min(m_xMin, x);
+    m_xMax = std::max(m_xMax, x);
+    m_yMin = std::min(m_yMin, y);
+    m_yMax = std::max(m_yMax, y);
   }
 }
 
@@ -168,24 +120,10 @@ void checkPositiveRangeAndAddMargin(float * min, float * max) {
 
 void PlotStore::initRange() {
   if (m_axesAuto) {
-    float xMin = FLT_MAX;
-    float xMax = -FLT_MAX;
-    float yMin = FLT_MAX;
-    float yMax = -FLT_MAX;
-    for (PlotStore::Dot dot : dots()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, dot.x(), dot.y());
-    }
-    for (PlotStore::Label label : labels()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, label.x(), label.y());
-    }
-    for (PlotStore::Segment segment : segments()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, segment.xStart(), segment.yStart());
-      updateRange(&xMin, &xMax, &yMin, &yMax, segment.xEnd(), segment.yEnd());
-    }
-    for (PlotStore::Rect rectangle : rects()) {
-      updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.left(), rectangle.top());
-      updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.right(), rectangle.bottom());
-    }
+    float xMin = m_xMin;
+    float xMax = m_xMax;
+    float yMin = m_yMin;
+    float yMax = m_yMax;
     checkPositiveRangeAndAddMargin(&xMin, &xMax);
     checkPositiveRangeAndAddMargin(&yMin, &yMax);
     setXMin(xMin);
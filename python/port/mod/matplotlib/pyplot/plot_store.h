@@ -9,43 +9,40 @@ extern "C" {
 
 namespace Matplotlib {
 
+/* The figures are stored as packed floats in arrays allocated on the Python
+ * heap, rather than as lists of tuples of boxed floats. The arrays are kept
+ * alive by scanning the store when collecting the garbage. */
+
 class PlotStore : public Shared::InteractiveCurveViewRange {
 public:
   PlotStore();
   void flush();
 
-  // Iterators
-
-  template <class T>
-  class ListIterator {
-  public:
-    static ListIterator Begin(mp_obj_t list);
-    static ListIterator End(mp_obj_t list);
-    T operator*();
-    ListIterator & operator++();
-    bool operator!=(const ListIterator & it) const;
-  private:
-    ListIterator() : m_tupleIndex(0) {}
-    mp_obj_t * m_tuples;
-    size_t m_numberOfTuples;
-    size_t m_tupleIndex;
-  };
+  // Array
 
   template <class T>
-  class Iterable {
+  class Array {
   public:
-    Iterable(mp_obj_t list) : m_list(list) {}
-    T begin() const { return T::Begin(m_list); }
-    T end() const { return T::End(m_list); }
+    void init() {
+      m_items = nullptr;
+      m_numberOfItems = 0;
+      m_capacity = 0;
+    }
+    void append(const T & item);
+    const T * begin() const { return m_items; }
+    const T * end() const { return m_items + m_numberOfItems; }
+    size_t numberOfItems() const { return m_numberOfItems; }
   private:
-    mp_obj_t m_list;
+    T * m_items;
+    size_t m_numberOfItems;
+    size_t m_capacity;
   };
 
   // Dot
 
   class Dot {
   public:
-    Dot(mp_obj_t tuple);
+    Dot(float x, float y, KDColor color) : m_x(x), m_y(y), m_color(color) {}
     float x() const { return m_x; }
     float y() const { return m_y; }
     KDColor color() const { return m_color; }
@@ -56,13 +53,14 @@ public:
   };
 
   void addDot(mp_obj_t x, mp_obj_t y, KDColor c);
-  Iterable<ListIterator<Dot>> dots() { return Iterable<ListIterator<Dot>>(m_dots); }
+  const Array<Dot> & dots() const { return m_dots; }
 
   // Segment
 
   class Segment {
   public:
-    Segment(mp_obj_t tuple);
+    Segment(float xStart, float yStart, float xEnd, float yEnd, float arrowWidth, KDColor color) :
+      m_xStart(xStart), m_yStart(yStart), m_xEnd(xEnd), m_yEnd(yEnd), m_arrowWidth(arrowWidth), m_color(color) {}
     float xStart() const { return m_xStart; }
     float yStart() const { return m_yStart; }
     float xEnd() const { return m_xEnd; }
@@ -79,13 +77,37 @@ public:
   };
 
   void addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd, mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth = mp_obj_new_float(NAN));
-  Iterable<ListIterator<Segment>> segments() { return Iterable<ListIterator<Segment>>(m_segments); }
+  const Array<Segment> & segments() const { return m_segments; }
+
+  // Curve
+
+  struct Point {
+    float x;
+    float y;
+  };
+
+  class Curve {
+  public:
+    Curve(const Point * points, size_t numberOfPoints, KDColor color) : m_points(points), m_numberOfPoints(numberOfPoints), m_color(color) {}
+    const Point * begin() const { return m_points; }
+    const Point * end() const { return m_points + m_numberOfPoints; }
+    KDColor color() const { return m_color; }
+  private:
+    const Point * m_points;
+    size_t m_numberOfPoints;
+    KDColor m_color;
+  };
+
+  // The points must have been allocated with m_new, the store then owns them
+  void addCurve(const Point * points, size_t numberOfPoints, KDColor c);
+  const Array<Curve> & curves() const { return m_curves; }
 
   // Rect
 
   class Rect {
   public:
-    Rect(mp_obj_t tuple);
+    Rect(float left, float right, float top, float bottom, KDColor color) :
+      m_left(left), m_right(right), m_top(top), m_bottom(bottom), m_color(color) {}
     float left() const { return m_left; }
     float right() const { return m_right; }
     float top() const { return m_top; }
@@ -100,24 +122,24 @@ public:
   };
 
   void addRect(mp_obj_t x, mp_obj_t y, mp_obj_t width, mp_obj_t height, KDColor c);
-  Iterable<ListIterator<Rect>> rects() { return Iterable<ListIterator<Rect>>(m_rects); }
+  const Array<Rect> & rects() const { return m_rects; }
 
   // Label
 
   class Label {
   public:
-    Label(mp_obj_t tuple);
+    Label(float x, float y, mp_obj_t string) : m_x(x), m_y(y), m_string(string) {}
     float x() const { return m_x; }
     float y() const { return m_y; }
-    const char * string() const { return m_string; }
+    const char * string() const { return mp_obj_str_get_str(m_string); }
   private:
     float m_x;
     float m_y;
-    const char * m_string;
+    mp_obj_t m_string;
   };
 
   void addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string);
-  Iterable<ListIterator<Label>> labels() { return Iterable<ListIterator<Label>>(m_labels); }
+  const Array<Label> & labels() const { return m_labels; }
 
   void setAxesRequested(bool b) { m_axesRequested = b; }
   bool axesRequested() const { return m_axesRequested; }
@@ -129,10 +151,17 @@ public:
   void setGridRequested(bool b) { m_gridRequested = b; }
   bool gridRequested() const { return m_gridRequested; }
 private:
-  mp_obj_t m_dots; // List of (x, y, color)
-  mp_obj_t m_labels; // List of (x, y, string)
-  mp_obj_t m_segments; // List of (x, y, dx, dy, style, color)
-  mp_obj_t m_rects; // List of (x, y, w, h, color)
+  // The bounds of the figures are updated as they are added
+  void updateBounds(float x, float y);
+  Array<Dot> m_dots;
+  Array<Label> m_labels;
+  Array<Segment> m_segments;
+  Array<Curve> m_curves;
+  Array<Rect> m_rects;
+  float m_xMin;
+  float m_xMax;
+  float m_yMin;
+  float m_yMax;
   bool m_axesRequested;
   bool m_axesAuto;
   bool m_gridRequested;
@@ -30,6 +30,10 @@ void PlotView::drawRect(KDContext * ctx, KDRect rect) const {
     traceSegment(ctx, rect, segment);
   }
 
+  for (const PlotStore::Curve & curve : m_store->curves()) {
+    traceCurve(ctx, rect, curve);
+  }
+
   for (PlotStore::Rect rectangle : m_store->rects()) {
     traceRect(ctx, rect, rectangle);
   }
@@ -53,6 +57,48 @@ void PlotView::traceSegment(KDContext * ctx, KDRect r, PlotStore::Segment segmen
   }
 }
 
+void PlotView::traceCurve(KDContext * ctx, KDRect r, const PlotStore::Curve & curve) const {
+  /* Consecutive points falling in the same pixel column are decimated: they
+   * are drawn as a vertical segment between their lowest and highest values,
+   * joined to the previous and next columns by their first and last points.
+   * This draws as many segments as there are columns, however many points the
+   * curve has. */
+  const PlotStore::Point * previous = nullptr;
+  const PlotStore::Point * first = nullptr;
+  const PlotStore::Point * last = nullptr;
+  float column = NAN;
+  float yMin = NAN;
+  float yMax = NAN;
+  for (const PlotStore::Point & point : curve) {
+    float pointColumn = std::floor(floatToPixel(Axis::Horizontal, point.x));
+    if (first != nullptr && pointColumn == column && !std::isnan(yMin) && !std::isnan(point.y)) {
+      yMin = std::min(yMin, point.y);
+      yMax = std::max(yMax, point.y);
+      last = &point;
+      continue;
+    }
+    if (first != nullptr) {
+      traceColumn(ctx, r, previous, first, last, yMin, yMax, curve.color());
+      previous = last;
+    }
+    first = last = &point;
+    column = pointColumn;
+    yMin = yMax = point.y;
+  }
+  if (first != nullptr) {
+    traceColumn(ctx, r, previous, first, last, yMin, yMax, curve.color());
+  }
+}
+
+void PlotView::traceColumn(KDContext * ctx, KDRect r, const PlotStore::Point * previous, const PlotStore::Point * first, const PlotStore::Point * last, float yMin, float yMax, KDColor color) const {
+  if (previous != nullptr) {
+    drawSegment(ctx, r, previous->x, previous->y, first->x, first->y, color);
+  }
+  if (first != last) {
+    drawSegment(ctx, r, first->x, yMin, first->x, yMax, color);
+  }
+}
+
 void PlotView::traceRect(KDContext * ctx, KDRect r, PlotStore::Rect rect) const {
   KDCoordinate left = std::round(floatToPixel(Axis::Horizontal, rect.left()));
   KDCoordinate right = std::round(floatToPixel(Axis::Horizontal, rect.right()));
@@ -13,6 +13,8 @@ public:
 private:
   void traceDot(KDContext * ctx, KDRect r, PlotStore::Dot dot) const;
   void traceSegment(KDContext * ctx, KDRect r, PlotStore::Segment segment) const;
+  void traceCurve(KDContext * ctx, KDRect r, const PlotStore::Curve & curve) const;
+  void traceColumn(KDContext * ctx, KDRect r, const PlotStore::Point * previous, const PlotStore::Point * first, const PlotStore::Point * last, float yMin, float yMax, KDColor color) const;
   void traceRect(KDContext * ctx, KDRect r, PlotStore::Rect rect) const;
   void traceLabel(KDContext * ctx, KDRect r, PlotStore::Label label) const;
   PlotStore * m_store;
@@ -0,0 +1,451 @@
+extern "C" {
+#include "modnumpy.h"
+#include <py/runtime.h>
+}
+#include <algorithm>
+#include <assert.h>
+#include <math.h>
+
+// Private helpers
+
+// The size in bytes of longer arrays would overflow
+static constexpr size_t k_maxLength = SIZE_MAX / sizeof(mp_float_t);
+
+static modnumpy_ndarray_t * NewArray(size_t length) {
+  if (length > k_maxLength) {
+    mp_raise_msg(&mp_type_MemoryError, "array is too large");
+  }
+  modnumpy_ndarray_t * array = m_new_obj(modnumpy_ndarray_t);
+  array->base.type = &modnumpy_ndarray_type;
+  array->owner = MP_OBJ_FROM_PTR(array);
+  array->items = m_new(mp_float_t, length);
+  array->length = length;
+  array->stride = 1;
+  return array;
+}
+
+static bool IsArray(mp_obj_t o) {
+  return mp_obj_is_type(o, &modnumpy_ndarray_type);
+}
+
+static bool IsScalar(mp_obj_t o) {
+  return mp_obj_is_float(o) || mp_obj_is_integer(o);
+}
+
+static modnumpy_ndarray_t * CopyOfArray(const modnumpy_ndarray_t * array) {
+  modnumpy_ndarray_t * copy = NewArray(array->length);
+  for (size_t i = 0; i < array->length; i++) {
+    copy->items[i] = modnumpy_ndarray_item(array, i);
+  }
+  return copy;
+}
+
+/* Arrays are used as they are, other iterables of numbers are copied in a new
+ * array. */
+static const modnumpy_ndarray_t * ArrayFromObject(mp_obj_t o) {
+  if (IsArray(o)) {
+    return static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(o));
+  }
+  if (!mp_obj_is_type(o, &mp_type_tuple) && !mp_obj_is_type(o, &mp_type_list)) {
+    o = mp_type_list.make_new(&mp_type_list, 1, 0, &o);
+  }
+  size_t length;
+  mp_obj_t * items;
+  mp_obj_get_array(o, &length, &items);
+  modnumpy_ndarray_t * array = NewArray(length);
+  for (size_t i = 0; i < length; i++) {
+    array->items[i] = mp_obj_get_float(items[i]);
+  }
+  return array;
+}
+
+static size_t LengthFromObject(mp_obj_t length) {
+  mp_int_t l = mp_obj_get_int(length);
+  if (l < 0) {
+    mp_raise_ValueError("negative dimensions are not allowed");
+  }
+  return l;
+}
+
+// NaN are sorted last, as numpy does
+static bool IsLess(mp_float_t a, mp_float_t b) {
+  return a < b || (isnan(b) && !isnan(a));
+}
+
+// ndarray
+
+void modnumpy_ndarray_print(const mp_print_t * print, mp_obj_t self, mp_print_kind_t kind) {
+  const modnumpy_ndarray_t * array = static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(self));
+  mp_print_str(print, "array([");
+  for (size_t i = 0; i < array->length; i++) {
+    if (i > 0) {
+      mp_print_str(print, ", ");
+    }
+    mp_obj_print_helper(print, mp_obj_new_float(modnumpy_ndarray_item(array, i)), PRINT_REPR);
+  }
+  mp_print_str(print, "])");
+}
+
+mp_obj_t modnumpy_ndarray_unary_op(mp_unary_op_t op, mp_obj_t self) {
+  const modnumpy_ndarray_t * array = static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(self));
+  switch (op) {
+    case MP_UNARY_OP_BOOL:
+      return mp_obj_new_bool(array->length > 0);
+    case MP_UNARY_OP_LEN:
+      return MP_OBJ_NEW_SMALL_INT(array->length);
+    case MP_UNARY_OP_POSITIVE:
+      return MP_OBJ_FROM_PTR(CopyOfArray(array));
+    case MP_UNARY_OP_NEGATIVE:
+    case MP_UNARY_OP_ABS:
+    {
+      modnumpy_ndarray_t * result = NewArray(array->length);
+      for (size_t i = 0; i < array->length; i++) {
+        mp_float_t x = modnumpy_ndarray_item(array, i);
+        result->items[i] = op == MP_UNARY_OP_NEGATIVE ? -x : MICROPY_FLOAT_C_FUN(fabs)(x);
+      }
+      return MP_OBJ_FROM_PTR(result);
+    }
+    default:
+      return MP_OBJ_NULL; // op not supported
+  }
+}
+
+mp_obj_t modnumpy_ndarray_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+  /* The runtime calls the reversed operation on the array when the left
+   * operand is a number, as in 2*a. In-place operations write their result in
+   * the items of the array. */
+  bool reversed = op >= MP_BINARY_OP_REVERSE_OR;
+  bool inPlace = op >= MP_BINARY_OP_INPLACE_OR && op <= MP_BINARY_OP_INPLACE_POWER;
+  if (reversed) {
+    op = static_cast<mp_binary_op_t>(op - (MP_BINARY_OP_REVERSE_OR - MP_BINARY_OP_OR));
+  } else if (inPlace) {
+    op = static_cast<mp_binary_op_t>(op - (MP_BINARY_OP_INPLACE_OR - MP_BINARY_OP_OR));
+  }
+  if (op != MP_BINARY_OP_ADD && op != MP_BINARY_OP_SUBTRACT && op != MP_BINARY_OP_MULTIPLY && op != MP_BINARY_OP_TRUE_DIVIDE && op != MP_BINARY_OP_POWER) {
+    return MP_OBJ_NULL; // op not supported
+  }
+  modnumpy_ndarray_t * array = static_cast<modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(lhs));
+  const modnumpy_ndarray_t * other = nullptr;
+  mp_float_t scalar = 0.0;
+  if (IsScalar(rhs)) {
+    scalar = mp_obj_get_float(rhs);
+  } else if (IsArray(rhs) || mp_obj_is_type(rhs, &mp_type_tuple) || mp_obj_is_type(rhs, &mp_type_list)) {
+    other = ArrayFromObject(rhs);
+    if (other->length != array->length) {
+      mp_raise_ValueError("operands could not be broadcast together");
+    }
+    if (inPlace && other->owner == array->owner) {
+      // The items of the operand could be overwritten before being read
+      other = CopyOfArray(other);
+    }
+  } else {
+    return MP_OBJ_NULL; // op not supported
+  }
+  modnumpy_ndarray_t * result = inPlace ? array : NewArray(array->length);
+  for (size_t i = 0; i < array->length; i++) {
+    mp_float_t a = modnumpy_ndarray_item(array, i);
+    mp_float_t b = other != nullptr ? modnumpy_ndarray_item(other, i) : scalar;
+    if (reversed) {
+      std::swap(a, b);
+    }
+    mp_float_t r;
+    switch (op) {
+      case MP_BINARY_OP_ADD:
+        r = a + b;
+        break;
+      case MP_BINARY_OP_SUBTRACT:
+        r = a - b;
+        break;
+      case MP_BINARY_OP_MULTIPLY:
+        r = a * b;
+        break;
+      case MP_BINARY_OP_TRUE_DIVIDE:
+        r = a / b;
+        break;
+      default:
+        assert(op == MP_BINARY_OP_POWER);
+        // Squares, as in variances, are much faster without pow
+        r = b == 2.0 ? a * a : MICROPY_FLOAT_C_FUN(pow)(a, b);
+    }
+    result->items[(mp_int_t)i * result->stride] = r;
+  }
+  return MP_OBJ_FROM_PTR(result);
+}
+
+mp_obj_t modnumpy_ndarray_subscr(mp_obj_t self, mp_obj_t index, mp_obj_t value) {
+  if (value == MP_OBJ_NULL) {
+    return MP_OBJ_NULL; // Items cannot be deleted
+  }
+  modnumpy_ndarray_t * array = static_cast<modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(self));
+  if (mp_obj_is_type(index, &mp_type_slice)) {
+    // A slice is a view on the items of the array
+    mp_bound_slice_t bounds;
+    mp_seq_get_fast_slice_indexes(array->length, index, &bounds);
+    size_t length;
+    if (bounds.step > 0) {
+      length = bounds.start < bounds.stop ? (bounds.stop - bounds.start + bounds.step - 1) / bounds.step : 0;
+    } else {
+      // The stop bound is inclusive for negative steps
+      length = bounds.start >= bounds.stop ? (bounds.start - bounds.stop) / -bounds.step + 1 : 0;
+    }
+    modnumpy_ndarray_t * view = m_new_obj(modnumpy_ndarray_t);
+    view->base.type = &modnumpy_ndarray_type;
+    view->owner = array->owner;
+    view->items = length > 0 ? array->items + bounds.start * array->stride : array->items;
+    view->length = length;
+    view->stride = array->stride * bounds.step;
+    if (value == MP_OBJ_SENTINEL) {
+      return MP_OBJ_FROM_PTR(view);
+    }
+    if (IsScalar(value)) {
+      mp_float_t x = mp_obj_get_float(value);
+      for (size_t i = 0; i < length; i++) {
+        view->items[(mp_int_t)i * view->stride] = x;
+      }
+      return mp_const_none;
+    }
+    const modnumpy_ndarray_t * other = ArrayFromObject(value);
+    if (other->length != length) {
+      mp_raise_ValueError("could not broadcast input array into the slice");
+    }
+    if (other->owner == array->owner) {
+      other = CopyOfArray(other);
+    }
+    for (size_t i = 0; i < length; i++) {
+      view->items[(mp_int_t)i * view->stride] = modnumpy_ndarray_item(other, i);
+    }
+    return mp_const_none;
+  }
+  size_t i = mp_get_index(&modnumpy_ndarray_type, array->length, index, false);
+  if (value == MP_OBJ_SENTINEL) {
+    return mp_obj_new_float(modnumpy_ndarray_item(array, i));
+  }
+  array->items[(mp_int_t)i * array->stride] = mp_obj_get_float(value);
+  return mp_const_none;
+}
+
+typedef struct _modnumpy_ndarray_iterator_t {
+  mp_obj_base_t base;
+  mp_fun_1_t iternext;
+  mp_obj_t array;
+  size_t index;
+} modnumpy_ndarray_iterator_t;
+
+static mp_obj_t modnumpy_ndarray_iternext(mp_obj_t self) {
+  modnumpy_ndarray_iterator_t * iterator = static_cast<modnumpy_ndarray_iterator_t *>(MP_OBJ_TO_PTR(self));
+  const modnumpy_ndarray_t * array = static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(iterator->array));
+  if (iterator->index >= array->length) {
+    return MP_OBJ_STOP_ITERATION;
+  }
+  return mp_obj_new_float(modnumpy_ndarray_item(array, iterator->index++));
+}
+
+mp_obj_t modnumpy_ndarray_getiter(mp_obj_t self, mp_obj_iter_buf_t * iter_buf) {
+  static_assert(sizeof(modnumpy_ndarray_iterator_t) <= sizeof(mp_obj_iter_buf_t), "The iterator does not fit in its buffer");
+  modnumpy_ndarray_iterator_t * iterator = reinterpret_cast<modnumpy_ndarray_iterator_t *>(iter_buf);
+  iterator->base.type = &mp_type_polymorph_iter;
+  iterator->iternext = modnumpy_ndarray_iternext;
+  iterator->array = self;
+  iterator->index = 0;
+  return MP_OBJ_FROM_PTR(iterator);
+}
+
+mp_obj_t modnumpy_ndarray_copy(mp_obj_t self) {
+  return MP_OBJ_FROM_PTR(CopyOfArray(ArrayFromObject(self)));
+}
+
+mp_obj_t modnumpy_ndarray_sort(mp_obj_t self) {
+  modnumpy_ndarray_t * array = static_cast<modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(self));
+  if (array->stride == 1) {
+    std::sort(array->items, array->items + array->length, IsLess);
+    return mp_const_none;
+  }
+  // The items of views with a stride are sorted in a copy
+  modnumpy_ndarray_t * copy = CopyOfArray(array);
+  std::sort(copy->items, copy->items + copy->length, IsLess);
+  for (size_t i = 0; i < array->length; i++) {
+    array->items[(mp_int_t)i * array->stride] = copy->items[i];
+  }
+  return mp_const_none;
+}
+
+mp_obj_t modnumpy_ndarray_tolist(mp_obj_t self) {
+  const modnumpy_ndarray_t * array = static_cast<const modnumpy_ndarray_t *>(MP_OBJ_TO_PTR(self));
+  mp_obj_t list = mp_obj_new_list(array->length, nullptr);
+  for (size_t i = 0; i < array->length; i++) {
+    mp_obj_list_store(list, MP_OBJ_NEW_SMALL_INT(i), mp_obj_new_float(modnumpy_ndarray_item(array, i)));
+  }
+  return list;
+}
+
+// Array creation
+
+mp_obj_t modnumpy_array(mp_obj_t iterable) {
+  if (IsArray(iterable)) {
+    return MP_OBJ_FROM_PTR(CopyOfArray(ArrayFromObject(iterable)));
+  }
+  // The array was already copied from the iterable
+  return MP_OBJ_FROM_PTR(const_cast<modnumpy_ndarray_t *>(ArrayFromObject(iterable)));
+}
+
+static mp_obj_t FilledArray(mp_obj_t length, mp_float_t value) {
+  modnumpy_ndarray_t * array = NewArray(LengthFromObject(length));
+  for (size_t i = 0; i < array->length; i++) {
+    array->items[i] = value;
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
+
+mp_obj_t modnumpy_zeros(mp_obj_t length) {
+  return FilledArray(length, 0.0);
+}
+
+mp_obj_t modnumpy_ones(mp_obj_t length) {
+  return FilledArray(length, 1.0);
+}
+
+/* linspace(start, stop, num)
+ * num items evenly spaced from start to stop, both included. num defaults
+ * to 50. */
+
+mp_obj_t modnumpy_linspace(size_t n_args, const mp_obj_t * args) {
+  mp_float_t start = mp_obj_get_float(args[0]);
+  mp_float_t stop = mp_obj_get_float(args[1]);
+  size_t length = n_args >= 3 ? LengthFromObject(args[2]) : 50;
+  modnumpy_ndarray_t * array = NewArray(length);
+  mp_float_t step = length > 1 ? (stop - start) / (length - 1) : 0.0;
+  for (size_t i = 0; i < length; i++) {
+    array->items[i] = start + i * step;
+  }
+  if (length > 1) {
+    array->items[length - 1] = stop;
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
+
+/* arange(stop), arange(start, stop), arange(start, stop, step)
+ * Items from start, included, to stop, excluded. start defaults to 0 and step
+ * to 1. */
+
+mp_obj_t modnumpy_arange(size_t n_args, const mp_obj_t * args) {
+  mp_float_t start = n_args >= 2 ? mp_obj_get_float(args[0]) : 0.0;
+  mp_float_t stop = mp_obj_get_float(args[n_args >= 2 ? 1 : 0]);
+  mp_float_t step = n_args >= 3 ? mp_obj_get_float(args[2]) : 1.0;
+  if (step == 0.0) {
+    mp_raise_ValueError("step must not be zero");
+  }
+  mp_float_t numberOfSteps = MICROPY_FLOAT_C_FUN(ceil)((stop - start) / step);
+  if (!isfinite(numberOfSteps)) {
+    mp_raise_ValueError("arange bounds must be finite");
+  }
+  if (numberOfSteps > static_cast<mp_float_t>(k_maxLength)) {
+    mp_raise_msg(&mp_type_MemoryError, "array is too large");
+  }
+  size_t length = numberOfSteps > 0 ? static_cast<size_t>(numberOfSteps) : 0;
+  modnumpy_ndarray_t * array = NewArray(length);
+  for (size_t i = 0; i < length; i++) {
+    array->items[i] = start + i * step;
+  }
+  return MP_OBJ_FROM_PTR(array);
+}
+
+// Universal functions
+
+static mp_obj_t ApplyToEachItem(mp_obj_t x, mp_float_t (*function)(mp_float_t)) {
+  if (IsScalar(x)) {
+    return mp_obj_new_float(function(mp_obj_get_float(x)));
+  }
+  const modnumpy_ndarray_t * array = ArrayFromObject(x);
+  modnumpy_ndarray_t * result = NewArray(array->length);
+  for (size_t i = 0; i < array->length; i++) {
+    result->items[i] = function(modnumpy_ndarray_item(array, i));
+  }
+  return MP_OBJ_FROM_PTR(result);
+}
+
+mp_obj_t modnumpy_sin(mp_obj_t x) {
+  return ApplyToEachItem(x, MICROPY_FLOAT_C_FUN(sin));
+}
+
+mp_obj_t modnumpy_cos(mp_obj_t x) {
+  return ApplyToEachItem(x, MICROPY_FLOAT_C_FUN(cos));
+}
+
+mp_obj_t modnumpy_tan(mp_obj_t x) {
+  return ApplyToEachItem(x, MICROPY_FLOAT_C_FUN(tan));
+}
+
+mp_obj_t modnumpy_exp(mp_obj_t x) {
+  return ApplyToEachItem(x, MICROPY_FLOAT_C_FUN(exp));
+}
+
+mp_obj_t modnumpy_log(mp_obj_t x) {
+  return ApplyToEachItem(x, MICROPY_FLOAT_C_FUN(log));
+}
+
+mp_obj_t modnumpy_sqrt(mp_obj_t x) {
+  return ApplyToEachItem(x, MICROPY_FLOAT_C_FUN(sqrt));
+}
+
+// Reductions
+
+static mp_float_t Sum(const modnumpy_ndarray_t * array) {
+  mp_float_t sum = 0.0;
+  for (size_t i = 0; i < array->length; i++) {
+    sum += modnumpy_ndarray_item(array, i);
+  }
+  return sum;
+}
+
+mp_obj_t modnumpy_sum(mp_obj_t x) {
+  return mp_obj_new_float(Sum(ArrayFromObject(x)));
+}
+
+mp_obj_t modnumpy_mean(mp_obj_t x) {
+  const modnumpy_ndarray_t * array = ArrayFromObject(x);
+  return mp_obj_new_float(array->length > 0 ? Sum(array) / array->length : NAN);
+}
+
+mp_obj_t modnumpy_std(mp_obj_t x) {
+  // Standard deviation of the population, computed in two passes
+  const modnumpy_ndarray_t * array = ArrayFromObject(x);
+  if (array->length == 0) {
+    return mp_obj_new_float(NAN);
+  }
+  mp_float_t mean = Sum(array) / array->length;
+  mp_float_t sumOfSquares = 0.0;
+  for (size_t i = 0; i < array->length; i++) {
+    mp_float_t deviation = modnumpy_ndarray_item(array, i) - mean;
+    sumOfSquares += deviation * deviation;
+  }
+  return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(sumOfSquares / array->length));
+}
+
+static mp_obj_t Extremum(mp_obj_t x, bool maximum) {
+  const modnumpy_ndarray_t * array = ArrayFromObject(x);
+  if (array->length == 0) {
+    mp_raise_ValueError("zero-size array has no minimum or maximum");
+  }
+  mp_float_t extremum = modnumpy_ndarray_item(array, 0);
+  for (size_t i = 1; i < array->length; i++) {
+    mp_float_t item = modnumpy_ndarray_item(array, i);
+    if (maximum ? item > extremum : item < extremum) {
+      extremum = item;
+    }
+  }
+  return mp_obj_new_float(extremum);
+}
+
+mp_obj_t modnumpy_min(mp_obj_t x) {
+  return Extremum(x, false);
+}
+
+mp_obj_t modnumpy_max(mp_obj_t x) {
+  return Extremum(x, true);
+}
+
+mp_obj_t modnumpy_sort(mp_obj_t x) {
+  mp_obj_t sorted = modnumpy_array(x);
+  modnumpy_ndarray_sort(sorted);
+  return sorted;
+}
@@ -0,0 +1,61 @@
+#ifndef PYTHON_MOD_NUMPY_H
+#define PYTHON_MOD_NUMPY_H
+
+#include <py/obj.h>
+
+/* Arrays of floats whose items are stored contiguously, rather than boxed in
+ * float objects. Slices of an array are views which share its items: they only
+ * differ by their first item, length and stride. */
+
+typedef struct _modnumpy_ndarray_t {
+  mp_obj_base_t base;
+  mp_obj_t owner; // Array which allocated the items, kept alive by its views
+  mp_float_t * items;
+  size_t length;
+  mp_int_t stride;
+} modnumpy_ndarray_t;
+
+extern const mp_obj_type_t modnumpy_ndarray_type;
+
+static inline mp_float_t modnumpy_ndarray_item(const modnumpy_ndarray_t * array, size_t index) {
+  return array->items[(mp_int_t)index * array->stride];
+}
+
+// ndarray
+
+void modnumpy_ndarray_print(const mp_print_t * print, mp_obj_t self, mp_print_kind_t kind);
+mp_obj_t modnumpy_ndarray_unary_op(mp_unary_op_t op, mp_obj_t self);
+mp_obj_t modnumpy_ndarray_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs);
+mp_obj_t modnumpy_ndarray_subscr(mp_obj_t self, mp_obj_t index, mp_obj_t value);
+mp_obj_t modnumpy_ndarray_getiter(mp_obj_t self, mp_obj_iter_buf_t * iter_buf);
+mp_obj_t modnumpy_ndarray_copy(mp_obj_t self);
+mp_obj_t modnumpy_ndarray_sort(mp_obj_t self);
+mp_obj_t modnumpy_ndarray_tolist(mp_obj_t self);
+
+// Array creation
+
+mp_obj_t modnumpy_array(mp_obj_t iterable);
+mp_obj_t modnumpy_zeros(mp_obj_t length);
+mp_obj_t modnumpy_ones(mp_obj_t length);
+mp_obj_t modnumpy_linspace(size_t n_args, const mp_obj_t * args);
+mp_obj_t modnumpy_arange(size_t n_args, const mp_obj_t * args);
+
+// Universal functions, applied to each item
+
+mp_obj_t modnumpy_sin(mp_obj_t x);
+mp_obj_t modnumpy_cos(mp_obj_t x);
+mp_obj_t modnumpy_tan(mp_obj_t x);
+mp_obj_t modnumpy_exp(mp_obj_t x);
+mp_obj_t modnumpy_log(mp_obj_t x);
+mp_obj_t modnumpy_sqrt(mp_obj_t x);
+
+// Reductions
+
+mp_obj_t modnumpy_sum(mp_obj_t x);
+mp_obj_t modnumpy_mean(mp_obj_t x);
+mp_obj_t modnumpy_std(mp_obj_t x);
+mp_obj_t modnumpy_min(mp_obj_t x);
+mp_obj_t modnumpy_max(mp_obj_t x);
+mp_obj_t modnumpy_sort(mp_obj_t x);
+
+#endif
@@ -0,0 +1,81 @@
+#include "modnumpy.h"
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_ndarray_copy_obj, modnumpy_ndarray_copy);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_ndarray_sort_obj, modnumpy_ndarray_sort);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_ndarray_tolist_obj, modnumpy_ndarray_tolist);
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_array_obj, modnumpy_array);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_zeros_obj, modnumpy_zeros);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_ones_obj, modnumpy_ones);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modnumpy_linspace_obj, 2, 3, modnumpy_linspace);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modnumpy_arange_obj, 1, 3, modnumpy_arange);
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_sin_obj, modnumpy_sin);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_cos_obj, modnumpy_cos);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_tan_obj, modnumpy_tan);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_exp_obj, modnumpy_exp);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_log_obj, modnumpy_log);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_sqrt_obj, modnumpy_sqrt);
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_sum_obj, modnumpy_sum);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_mean_obj, modnumpy_mean);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_std_obj, modnumpy_std);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_min_obj, modnumpy_min);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_max_obj, modnumpy_max);
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(modnumpy_sort_obj, modnumpy_sort);
+
+// Reductions are also methods of the arrays, as in a.mean()
+STATIC const mp_rom_map_elem_t modnumpy_ndarray_locals_table[] = {
+  { MP_ROM_QSTR(MP_QSTR_copy), MP_ROM_PTR(&modnumpy_ndarray_copy_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sort), MP_ROM_PTR(&modnumpy_ndarray_sort_obj) },
+  { MP_ROM_QSTR(MP_QSTR_tolist), MP_ROM_PTR(&modnumpy_ndarray_tolist_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&modnumpy_sum_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&modnumpy_mean_obj) },
+  { MP_ROM_QSTR(MP_QSTR_std), MP_ROM_PTR(&modnumpy_std_obj) },
+  { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&modnumpy_min_obj) },
+  { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&modnumpy_max_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modnumpy_ndarray_locals, modnumpy_ndarray_locals_table);
+
+const mp_obj_type_t modnumpy_ndarray_type = {
+  { &mp_type_type },
+  .name = MP_QSTR_ndarray,
+  .print = modnumpy_ndarray_print,
+  .unary_op = modnumpy_ndarray_unary_op,
+  .binary_op = modnumpy_ndarray_binary_op,
+  .subscr = modnumpy_ndarray_subscr,
+  .getiter = modnumpy_ndarray_getiter,
+  .locals_dict = (mp_obj_dict_t*)&modnumpy_ndarray_locals,
+};
+
+STATIC const mp_rom_map_elem_t modnumpy_module_globals_table[] = {
+  { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_numpy) },
+  { MP_ROM_QSTR(MP_QSTR_ndarray), MP_ROM_PTR(&modnumpy_ndarray_type) },
+  { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&modnumpy_array_obj) },
+  { MP_ROM_QSTR(MP_QSTR_zeros), MP_ROM_PTR(&modnumpy_zeros_obj) },
+  { MP_ROM_QSTR(MP_QSTR_ones), MP_ROM_PTR(&modnumpy_ones_obj) },
+  { MP_ROM_QSTR(MP_QSTR_linspace), MP_ROM_PTR(&modnumpy_linspace_obj) },
+  { MP_ROM_QSTR(MP_QSTR_arange), MP_ROM_PTR(&modnumpy_arange_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sin), MP_ROM_PTR(&modnumpy_sin_obj) },
+  { MP_ROM_QSTR(MP_QSTR_cos), MP_ROM_PTR(&modnumpy_cos_obj) },
+  { MP_ROM_QSTR(MP_QSTR_tan), MP_ROM_PTR(&modnumpy_tan_obj) },
+  { MP_ROM_QSTR(MP_QSTR_exp), MP_ROM_PTR(&modnumpy_exp_obj) },
+  { MP_ROM_QSTR(MP_QSTR_log), MP_ROM_PTR(&modnumpy_log_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sqrt), MP_ROM_PTR(&modnumpy_sqrt_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&modnumpy_sum_obj) },
+  { MP_ROM_QSTR(MP_QSTR_mean), MP_ROM_PTR(&modnumpy_mean_obj) },
+  { MP_ROM_QSTR(MP_QSTR_std), MP_ROM_PTR(&modnumpy_std_obj) },
+  { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&modnumpy_min_obj) },
+  { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&modnumpy_max_obj) },
+  { MP_ROM_QSTR(MP_QSTR_sort), MP_ROM_PTR(&modnumpy_sort_obj) },
+  { MP_ROM_QSTR(MP_QSTR_pi), mp_const_float_pi },
+  { MP_ROM_QSTR(MP_QSTR_e), mp_const_float_e },
+};
+
+STATIC MP_DEFINE_CONST_DICT(modnumpy_module_globals, modnumpy_module_globals_table);
+
+const mp_obj_module_t modnumpy_module = {
+  .base = { &mp_type_module },
+  .globals = (mp_obj_dict_t*)&modnumpy_module_globals,
+};
@@ -206,4 +206,20 @@ mp_obj_t modturtle_write(mp_obj_t s) {
   const char * string = mp_obj_str_get_str(s);
   sTurtle.write(string);
   return mp_const_none;
-}
\ No newline at end of file
+}
+
+/* tracer(n, delay) turns the animation of the turtle off when n is 0. The delay
+ * is accepted for compatibility but ignored. */
+
+mp_obj_t modturtle_tracer(size_t n_args, const mp_obj_t *args) {
+  if (n_args == 0) {
+    return MP_OBJ_NEW_SMALL_INT(sTurtle.isTracing() ? 1 : 0);
+  }
+  sTurtle.setTracing(mp_obj_get_int(args[0]) != 0);
+  return mp_const_none;
+}
+
+mp_obj_t modturtle_update() {
+  sTurtle.update();
+  return mp_const_none;
+}
@@ -30,3 +30,6 @@ mp_obj_t modturtle_colormode(size_t n_args, const mp_obj_t *args);
 
 mp_obj_t modturtle_showturtle();
 mp_obj_t modturtle_hideturtle();
+
+mp_obj_t modturtle_tracer(size_t n_args, const mp_obj_t *args);
+mp_obj_t modturtle_update();
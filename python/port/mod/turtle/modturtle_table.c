@@ -27,6 +27,9 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_0(modturtle_hideturtle_obj, modturtle_hideturtle)
 STATIC MP_DEFINE_CONST_FUN_OBJ_0(modturtle_isvisible_obj, modturtle_isvisible);
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(modturtle_write_obj, modturtle_write);
 
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(modturtle_tracer_obj, 0, 2, modturtle_tracer);
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(modturtle_update_obj, modturtle_update);
+
 STATIC MP_DEFINE_CONST_FUN_OBJ_0(modturtle___init___obj, modturtle___init__);
 
 STATIC const mp_rom_map_elem_t modturtle_module_globals_table[] = {
@@ -76,6 +79,9 @@ STATIC const mp_rom_map_elem_t modturtle_module_globals_table[] = {
   { MP_ROM_QSTR(MP_QSTR_ht), (mp_obj_t)&modturtle_hideturtle_obj },
   { MP_ROM_QSTR(MP_QSTR_isvisible), (mp_obj_t)&modturtle_isvisible_obj },
   { MP_ROM_QSTR(MP_QSTR_write), (mp_obj_t)&modturtle_write_obj },
+
+  { MP_ROM_QSTR(MP_QSTR_tracer), (mp_obj_t)&modturtle_tracer_obj },
+  { MP_ROM_QSTR(MP_QSTR_update), (mp_obj_t)&modturtle_update_obj },
 };
 
 STATIC MP_DEFINE_CONST_DICT(modturtle_module_globals, modturtle_module_globals_table);
@@ -16,6 +16,43 @@ static constexpr KDCoordinate k_iconPawSize = 2;
 
 constexpr KDColor Turtle::k_defaultColor;
 
+/* Clip the segment from (x1, y1) to (x2, y2) to the given box with the
+ * Liang-Barsky algorithm. Return false if no part of the segment is inside. */
+static bool clipSegment(mp_float_t * x1, mp_float_t * y1, mp_float_t * x2, mp_float_t * y2, mp_float_t xMin, mp_float_t yMin, mp_float_t xMax, mp_float_t yMax) {
+  if (!std::isfinite(*x1) || !std::isfinite(*y1) || !std::isfinite(*x2) || !std::isfinite(*y2)) {
+    return false;
+  }
+  mp_float_t dx = *x2 - *x1;
+  mp_float_t dy = *y2 - *y1;
+  // The segment is inside the box for t between tMin and tMax
+  mp_float_t tMin = 0;
+  mp_float_t tMax = 1;
+  const mp_float_t directions[4] = {-dx, dx, -dy, dy};
+  const mp_float_t distances[4] = {*x1 - xMin, xMax - *x1, *y1 - yMin, yMax - *y1};
+  for (int i = 0; i < 4; i++) {
+    if (directions[i] == 0) {
+      if (distances[i] < 0) {
+        return false;
+      }
+      continue;
+    }
+    mp_float_t t = distances[i] / directions[i];
+    if (directions[i] < 0) {
+      tMin = t > tMin ? t : tMin;
+    } else {
+      tMax = t < tMax ? t : tMax;
+    }
+  }
+  if (tMin > tMax) {
+    return false;
+  }
+  *x2 = *x1 + tMax * dx;
+  *y2 = *y1 + tMax * dy;
+  *x1 = *x1 + tMin * dx;
+  *y1 = *y1 + tMin * dy;
+  return true;
+}
+
 template <typename T> static inline T * allocate(size_t count) {
   /* We forward dynamic allocations to the Python GC so we don't have to bother
    * with deallocation. For this to work well, the Turtle object who owns the
@@ -75,6 +112,14 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
   mp_float_t oldHeading = heading();
   mp_float_t length = std::fabs(angle * k_headingScale * radius);
   if (length > 1) {
+    if (!m_tracing) {
+      if (instantCircle(radius, angle)) {
+        // Keyboard interruption. Return now to let MicroPython process it.
+        return;
+      }
+      setHeading(oldHeading+angle);
+      return;
+    }
     for (int i = 1; i < length; i++) {
       mp_float_t progress = i / length;
       // Move the turtle forward
@@ -90,6 +135,9 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
 }
 
 bool Turtle::goTo(mp_float_t x, mp_float_t y) {
+  if (!m_tracing) {
+    return instantGoTo(x, y);
+  }
   mp_float_t oldx = m_x;
   mp_float_t oldy = m_y;
   mp_float_t xLength = absF(std::floor(x) - std::floor(oldx));
@@ -193,6 +241,20 @@ void Turtle::write(const char * string) {
   draw(true);
 }
 
+void Turtle::setTracing(bool tracing) {
+  m_tracing = tracing;
+  if (m_tracing) {
+    draw(true);
+  } else {
+    // Otherwise erasing the turtle later would also erase the new segments
+    erase();
+  }
+}
+
+void Turtle::update() {
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  drawIcon();
+}
 
 void Turtle::viewDidDisappear() {
   m_drawn = false;
@@ -270,7 +332,121 @@ KDRect Turtle::iconRect() const {
 bool Turtle::draw(bool force) {
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
 
-  if ((m_speed > 0 || force) && m_visible && !m_drawn && hasUnderneathPixelBuffer() && !isOutOfBounds()) {
+  if ((m_speed > 0 || force) && m_tracing) {
+    drawIcon();
+  }
+
+  /* TODO: Maybe this threshold should be in time (mileage/speed) instead of
+   * mileage to interrupt with the same frequency whatever the speed is. */
+  if (m_mileage > k_mileageLimit) {
+    if (micropython_port_interruptible_msleep(1 + (m_speed == 0 ? 0 : 3 * (k_maxSpeed - m_speed)))) {
+      return true;
+    }
+    m_mileage -= k_mileageLimit;
+  }
+  return false;
+}
+
+bool Turtle::instantGoTo(mp_float_t x, mp_float_t y) {
+  /* The segment is drawn at once, ended with dots like the animated path, and
+   * without tweening the turtle nor sleeping along the way. */
+  erase();
+  if (m_penDown && m_penSize > 0 && hasDotBuffers()) {
+    drawSegment(m_x, m_y, x, y);
+  }
+  m_x = x;
+  m_y = y;
+  return micropython_port_vm_hook_loop();
+}
+
+bool Turtle::instantCircle(mp_int_t radius, mp_float_t angle) {
+  /* The arc is drawn at once as chords of at most k_circleChordAngle degrees,
+   * whose ends lie on the circle. The chords are joined in polylines, which
+   * stamp one dot per joint instead of one per pixel of arc. */
+  erase();
+  mp_float_t oldHeading = m_heading;
+  int numberOfChords = std::ceil(std::fabs(angle) / k_circleChordAngle);
+  // The turtle turns left around a positive radius, as the animated path does
+  mp_float_t turn = std::copysign(angle, radius) / numberOfChords;
+  mp_float_t chordLength = std::fabs(2 * radius * std::sin(turn / 2 * k_headingScale));
+  bool drawing = m_penDown && m_penSize > 0 && hasDotBuffers();
+  /* Polylines need their points to fit in KDCoordinates: chords of circles
+   * that do not fit on the screen are clipped and drawn one by one instead. */
+  mp_float_t centerX = m_x - radius * std::sin(oldHeading * k_headingScale) + k_xOffset;
+  mp_float_t centerY = k_invertedYAxisCoefficient * (m_y + radius * std::cos(oldHeading * k_headingScale)) + k_yOffset;
+  mp_float_t absRadius = std::fabs(radius);
+  bool fitsOnScreen = centerX - absRadius >= -m_penSize && centerX + absRadius <= Ion::Display::Width + m_penSize
+    && centerY - absRadius >= -m_penSize && centerY + absRadius <= Ion::Display::Height + m_penSize;
+  KDPoint lineOffset((m_penSize - 1)/2 - m_penSize/2, (m_penSize - 1)/2 - m_penSize/2);
+  // Like the other buffers, points are allocated on the Python heap
+  KDPoint * points = drawing && fitsOnScreen ? allocate<KDPoint>(k_maxNumberOfCirclePoints) : nullptr;
+  int numberOfPoints = 0;
+  if (drawing) {
+    MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+  }
+  if (points != nullptr) {
+    points[numberOfPoints++] = position().translatedBy(lineOffset);
+  }
+  bool interrupted = false;
+  for (int i = 0; i < numberOfChords && !interrupted; i++) {
+    mp_float_t chordHeading = (oldHeading + turn * (i + 0.5f)) * k_headingScale;
+    mp_float_t x = m_x + chordLength * std::cos(chordHeading);
+    mp_float_t y = m_y + chordLength * std::sin(chordHeading);
+    if (points != nullptr) {
+      points[numberOfPoints++] = position(x, y).translatedBy(lineOffset);
+      if (numberOfPoints == k_maxNumberOfCirclePoints) {
+        // Go on with a new polyline from the last point
+        KDIonContext::sharedContext()->drawPolyline(points, numberOfPoints, m_color, m_penSize, m_dotMask, m_dotWorkingPixelBuffer);
+        points[0] = points[numberOfPoints - 1];
+        numberOfPoints = 1;
+      }
+    } else if (drawing) {
+      drawSegment(m_x, m_y, x, y);
+    }
+    m_x = x;
+    m_y = y;
+    interrupted = micropython_port_vm_hook_loop();
+  }
+  if (points != nullptr) {
+    if (numberOfPoints > 1) {
+      KDIonContext::sharedContext()->drawPolyline(points, numberOfPoints, m_color, m_penSize, m_dotMask, m_dotWorkingPixelBuffer);
+    }
+    m_free(points);
+  }
+  return interrupted;
+}
+
+void Turtle::drawSegment(mp_float_t x1, mp_float_t y1, mp_float_t x2, mp_float_t y2) {
+  assert(m_dotMask != nullptr && m_dotWorkingPixelBuffer != nullptr);
+  /* Clip the segment to the screen, widened by the pen size, so that long
+   * moves draw their visible part and fit in KDCoordinates. */
+  x1 += k_xOffset;
+  y1 = k_invertedYAxisCoefficient * y1 + k_yOffset;
+  x2 += k_xOffset;
+  y2 = k_invertedYAxisCoefficient * y2 + k_yOffset;
+  if (clipSegment(&x1, &y1, &x2, &y2, -m_penSize, -m_penSize, Ion::Display::Width + m_penSize, Ion::Display::Height + m_penSize)) {
+    MicroPython::ExecutionEnvironment::currentExecutionEnvironment()->displaySandbox();
+    KDPoint start(std::floor(x1), std::floor(y1));
+    KDPoint end(std::floor(x2), std::floor(y2));
+    /* With an even pen size, dots spread further to the top left of their
+     * center whereas thick lines spread further to the bottom right. */
+    KDPoint lineOffset((m_penSize - 1)/2 - m_penSize/2, (m_penSize - 1)/2 - m_penSize/2);
+    KDPoint points[] = {start.translatedBy(lineOffset), end.translatedBy(lineOffset)};
+    KDIonContext::sharedContext()->drawPolyline(points, 2, m_color, m_penSize, m_dotMask, m_dotWorkingPixelBuffer);
+  }
+}
+
+void Turtle::drawDot(KDPoint center) {
+  assert(m_dotMask != nullptr && m_dotWorkingPixelBuffer != nullptr);
+  KDRect rect(
+    center.translatedBy(KDPoint(-m_penSize/2, -m_penSize/2)),
+    KDSize(m_penSize, m_penSize)
+  );
+  KDIonContext::sharedContext()->blendRectWithMask(rect, m_color, m_dotMask, m_dotWorkingPixelBuffer);
+}
+
+void Turtle::drawIcon() {
+  if (m_visible && !m_drawn && hasUnderneathPixelBuffer() && !isOutOfBounds()) {
     KDContext * ctx = KDIonContext::sharedContext();
 
     // Get the pixels underneath the turtle
@@ -336,16 +512,6 @@ bool Turtle::draw(bool force) {
     }
     m_drawn = true;
   }
-
-  /* TODO: Maybe this threshold should be in time (mileage/speed) instead of
-   * mileage to interrupt with the same frequency whatever the speed is. */
-  if (m_mileage > k_mileageLimit) {
-    if (micropython_port_interruptible_msleep(1 + (m_speed == 0 ? 0 : 3 * (k_maxSpeed - m_speed)))) {
-      return true;
-    }
-    m_mileage -= k_mileageLimit;
-  }
-  return false;
 }
 
 bool Turtle::dot(mp_float_t x, mp_float_t y) {
@@ -353,12 +519,7 @@ bool Turtle::dot(mp_float_t x, mp_float_t y) {
 
   // Draw the dot if the pen is down
   if (m_penDown && hasDotBuffers() && !isOutOfBounds()) {
-    KDContext * ctx = KDIonContext::sharedContext();
-    KDRect rect(
-      position(x, y).translatedBy(KDPoint(-m_penSize/2, -m_penSize/2)),
-      KDSize(m_penSize, m_penSize)
-    );
-    ctx->blendRectWithMask(rect, m_color, m_dotMask, m_dotWorkingPixelBuffer);
+    drawDot(position(x, y));
   }
 
   /* Increase the turtle's mileage. We need to make sure the mileage is not
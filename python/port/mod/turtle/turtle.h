@@ -36,7 +36,8 @@ public:
     m_speed(k_defaultSpeed),
     m_penSize(k_defaultPenSize),
     m_mileage(0),
-    m_drawn(false)
+    m_drawn(false),
+    m_tracing(true)
   {
   }
 
@@ -80,6 +81,13 @@ public:
 
   void write(const char * string);
 
+  /* When the tracer is off, the turtle moves instantly: segments are drawn at
+   * once instead of dot by dot, and the turtle itself is only drawn on
+   * update(). */
+  bool isTracing() const { return m_tracing; }
+  void setTracing(bool tracing);
+  void update();
+
   void viewDidDisappear();
 
   /* isOutOfBounds returns true if nothing should be drawn at current position.
@@ -102,6 +110,9 @@ private:
   static constexpr uint8_t k_defaultPenSize = 1;
   static constexpr const KDFont * k_font = KDFont::LargeFont;
   static constexpr mp_float_t k_maxPosition = KDCOORDINATE_MAX * 0.75f;
+  // Without tracing, circles are drawn as chords of this many degrees
+  static constexpr mp_float_t k_circleChordAngle = 5;
+  static constexpr int k_maxNumberOfCirclePoints = static_cast<int>(360 / k_circleChordAngle) + 1;
 
   enum class PawType : uint8_t {
     FrontRight = 0,
@@ -131,7 +142,13 @@ private:
   // Interruptible methods that return true if they have been interrupted
   bool draw(bool force);
   bool dot(mp_float_t x, mp_float_t y);
+  bool instantGoTo(mp_float_t x, mp_float_t y);
+  bool instantCircle(mp_int_t radius, mp_float_t angle);
+
+  void drawSegment(mp_float_t x1, mp_float_t y1, mp_float_t x2, mp_float_t y2);
 
+  void drawDot(KDPoint center);
+  void drawIcon();
   void drawPaw(PawType type, PawPosition position);
   void erase();
 
@@ -174,6 +191,7 @@ private:
 
   uint16_t m_mileage;
   bool m_drawn;
+  bool m_tracing;
 
 };
 
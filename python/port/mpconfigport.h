@@ -33,6 +33,23 @@
 // Long int implementation
 #define MICROPY_LONGINT_IMPL (MICROPY_LONGINT_IMPL_MPZ)
 
+// Imported scripts are compiled to .mpy code which is cached, see port.cpp
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+#define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_SAVE (1)
+#define MICROPY_HAS_FILE_READER (1)
+#endif
+
+// Compile @micropython.native and @micropython.viper functions to machine code
+#if MICROPY_PORT_NATIVE_EMITTER && defined(__x86_64__)
+#define MICROPY_EMIT_X64 (1)
+// Native code is allocated outside of the heap, in executable memory
+#define MP_PLAT_ALLOC_EXEC(min_size, ptr, size) micropython_port_alloc_exec(min_size, (void **)(ptr), size)
+#define MP_PLAT_FREE_EXEC(ptr, size) micropython_port_free_exec(ptr, size)
+// Loops of native code call the VM hook, so they can be interrupted
+#define MICROPY_EMIT_NATIVE_LOOP_HOOK (1)
+#endif
+
 // Whether to include information in the byte code to determine source
 #define MICROPY_ENABLE_SOURCE_LINE (1)
 
@@ -55,7 +72,7 @@
 #define MICROPY_PY_ASYNC_AWAIT (0)
 
 // Whether to support bytearray object
-#define MICROPY_PY_BUILTINS_BYTEARRAY (0)
+#define MICROPY_PY_BUILTINS_BYTEARRAY (1)
 
 // Whether to support frozenset object
 #define MICROPY_PY_BUILTINS_FROZENSET (1)
@@ -63,6 +80,9 @@
 // Whether to support property object
 #define MICROPY_PY_BUILTINS_PROPERTY (0)
 
+// Whether to support reverse arithmetic operations, used by numpy for 2*array
+#define MICROPY_PY_REVERSE_SPECIAL_METHODS (1)
+
 // Whether to support unicode strings
 #define MICROPY_PY_BUILTINS_STR_UNICODE (1)
 
@@ -115,7 +135,10 @@
 // (This scheme won't work if we want to mix Thumb and normal ARM code.)
 #define MICROPY_MAKE_POINTER_CALLABLE(p) (p)
 
-#define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
+#define MICROPY_VM_HOOK_LOOP \
+    if (--micropython_port_vm_hook_countdown <= 0) { \
+        micropython_port_vm_hook_countdown_elapsed(); \
+    }
 
 typedef intptr_t mp_int_t; // must be pointer size
 typedef uintptr_t mp_uint_t; // must be pointer size
@@ -132,6 +155,7 @@ typedef long mp_off_t;
 extern const struct _mp_obj_module_t modion_module;
 extern const struct _mp_obj_module_t modkandinsky_module;
 extern const struct _mp_obj_module_t modmatplotlib_module;
+extern const struct _mp_obj_module_t modnumpy_module;
 extern const struct _mp_obj_module_t modpyplot_module;
 extern const struct _mp_obj_module_t modtime_module;
 extern const struct _mp_obj_module_t modos_module;
@@ -142,6 +166,7 @@ extern const struct _mp_obj_module_t modturtle_module;
     { MP_ROM_QSTR(MP_QSTR_kandinsky), MP_ROM_PTR(&modkandinsky_module) }, \
     { MP_ROM_QSTR(MP_QSTR_matplotlib), MP_ROM_PTR(&modmatplotlib_module) }, \
     { MP_ROM_QSTR(MP_QSTR_matplotlib_dot_pyplot), MP_ROM_PTR(&modpyplot_module) }, \
+    { MP_ROM_QSTR(MP_QSTR_numpy), MP_ROM_PTR(&modnumpy_module) }, \
     { MP_ROM_QSTR(MP_QSTR_time), MP_ROM_PTR(&modtime_module) }, \
     { MP_ROM_QSTR(MP_QSTR_os), MP_ROM_PTR(&modos_module) }, \
     { MP_ROM_QSTR(MP_QSTR_turtle), MP_ROM_PTR(&modturtle_module) }, \
@@ -55,6 +55,7 @@ extern "C" {
 #include "py/mphal.h"
 #include "py/nlr.h"
 #include "py/parsenum.h"
+#include "py/persistentcode.h"
 #include "py/repl.h"
 #include "py/runtime.h"
 #include "py/stackctrl.h"
@@ -66,6 +67,110 @@ extern "C" {
 #include <escher/palette.h>
 
 static MicroPython::ScriptProvider * sScriptProvider = nullptr;
+
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+
+/* The compiled scripts cache is a sequence of entries, each being a header
+ * followed by the .mpy code of a script. A header with no code ends the
+ * sequence. Scripts are identified by the lengths and checksums of their name
+ * and content.
+ * When there is no room left, the oldest entries are evicted. */
+class CompiledScriptsCache {
+public:
+  CompiledScriptsCache() : m_buffer(nullptr), m_size(0) {}
+  void setBuffer(char * buffer, size_t size) { m_buffer = buffer; m_size = size; }
+  bool isEnabled() const { return m_buffer != nullptr; }
+  struct ScriptIdentifier {
+    bool hasSameName(const ScriptIdentifier & other) const { return nameLength == other.nameLength && nameChecksum == other.nameChecksum; }
+    bool isSameScript(const ScriptIdentifier & other) const { return hasSameName(other) && contentLength == other.contentLength && contentChecksum == other.contentChecksum; }
+    uint32_t nameLength;
+    uint32_t nameChecksum;
+    uint32_t contentLength;
+    uint32_t contentChecksum;
+  };
+  const byte * codeOfScript(const ScriptIdentifier & script, size_t * codeSize) const;
+  // Return the cached code, or nullptr if it does not fit
+  const byte * storeCodeOfScript(const ScriptIdentifier & script, const byte * code, size_t codeSize);
+private:
+  struct Header {
+    ScriptIdentifier script;
+    uint32_t codeSize;
+  };
+  Header headerAt(size_t offset) const;
+  size_t endOffset() const;
+  void removeEntryAt(size_t offset);
+  static size_t EntrySize(size_t codeSize) { return sizeof(Header) + codeSize; }
+  char * m_buffer;
+  size_t m_size;
+};
+
+CompiledScriptsCache::Header CompiledScriptsCache::headerAt(size_t offset) const {
+  Header header = {{0, 0, 0, 0}, 0};
+  if (offset + sizeof(Header) <= m_size) {
+    // Entries are not aligned
+    memcpy(&header, m_buffer + offset, sizeof(Header));
+  }
+  return header;
+}
+
+size_t CompiledScriptsCache::endOffset() const {
+  size_t offset = 0;
+  Header header;
+  while ((header = headerAt(offset)).codeSize > 0) {
+    offset += EntrySize(header.codeSize);
+  }
+  return offset;
+}
+
+void CompiledScriptsCache::removeEntryAt(size_t offset) {
+  size_t entrySize = EntrySize(headerAt(offset).codeSize);
+  size_t end = endOffset();
+  memmove(m_buffer + offset, m_buffer + offset + entrySize, end - offset - entrySize);
+  memset(m_buffer + end - entrySize, 0, entrySize);
+}
+
+const byte * CompiledScriptsCache::codeOfScript(const ScriptIdentifier & script, size_t * codeSize) const {
+  size_t offset = 0;
+  Header header;
+  while ((header = headerAt(offset)).codeSize > 0) {
+    if (header.script.isSameScript(script)) {
+      *codeSize = header.codeSize;
+      return reinterpret_cast<const byte *>(m_buffer + offset + sizeof(Header));
+    }
+    offset += EntrySize(header.codeSize);
+  }
+  return nullptr;
+}
+
+const byte * CompiledScriptsCache::storeCodeOfScript(const ScriptIdentifier & script, const byte * code, size_t codeSize) {
+  // Keep room for the header ending the sequence
+  if (codeSize == 0 || EntrySize(codeSize) + sizeof(Header) > m_size) {
+    return nullptr;
+  }
+  // Evict the previous versions of the script, then the oldest scripts
+  size_t offset = 0;
+  Header header;
+  while ((header = headerAt(offset)).codeSize > 0) {
+    if (header.script.hasSameName(script)) {
+      removeEntryAt(offset);
+    } else {
+      offset += EntrySize(header.codeSize);
+    }
+  }
+  size_t end = offset;
+  while (end + EntrySize(codeSize) + sizeof(Header) > m_size) {
+    end -= EntrySize(headerAt(0).codeSize);
+    removeEntryAt(0);
+  }
+  header = {script, static_cast<uint32_t>(codeSize)};
+  memcpy(m_buffer + end, &header, sizeof(Header));
+  memcpy(m_buffer + end + sizeof(Header), code, codeSize);
+  return reinterpret_cast<const byte *>(m_buffer + end + sizeof(Header));
+}
+
+static CompiledScriptsCache sCompiledScriptsCache;
+
+#endif
 static MicroPython::ExecutionEnvironment * sCurrentExecutionEnvironment = nullptr;
 
 MicroPython::ExecutionEnvironment * MicroPython::ExecutionEnvironment::currentExecutionEnvironment() {
@@ -154,6 +259,56 @@ void MicroPython::ExecutionEnvironment::interrupt() {
   mp_keyboard_interrupt();
 }
 
+#if MICROPY_EMIT_NATIVE
+#include <sys/mman.h>
+
+/* Native code is allocated in a mapping of its own, so that no other memory
+ * is made executable. It refers to objects only through the constant tables
+ * of its functions, which are in the heap, so the garbage collector does not
+ * need to scan it. The mapping is created on the first allocation and
+ * released with the heap; in the meantime, only the last allocation can be
+ * freed, which happens when a compilation fails. */
+static constexpr size_t k_executableMemorySize = 16 * 1024;
+static byte * sExecutableMemory = nullptr;
+static size_t sExecutableMemoryUsed = 0;
+
+static size_t executableAllocationSize(size_t size) {
+  return (size + sizeof(mp_uint_t) - 1) & ~(sizeof(mp_uint_t) - 1);
+}
+
+void micropython_port_alloc_exec(size_t min_size, void ** ptr, size_t * size) {
+  if (sExecutableMemory == nullptr) {
+    void * memory = mmap(nullptr, k_executableMemorySize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+      mp_raise_msg(&mp_type_RuntimeError, "native code is not supported");
+    }
+    sExecutableMemory = static_cast<byte *>(memory);
+    sExecutableMemoryUsed = 0;
+  }
+  size_t allocationSize = executableAllocationSize(min_size);
+  if (allocationSize > k_executableMemorySize - sExecutableMemoryUsed) {
+    m_malloc_fail(min_size);
+  }
+  *ptr = sExecutableMemory + sExecutableMemoryUsed;
+  *size = min_size;
+  sExecutableMemoryUsed += allocationSize;
+}
+
+void micropython_port_free_exec(void * ptr, size_t size) {
+  size_t allocationSize = executableAllocationSize(size);
+  if (static_cast<byte *>(ptr) + allocationSize == sExecutableMemory + sExecutableMemoryUsed) {
+    sExecutableMemoryUsed -= allocationSize;
+  }
+}
+
+static void releaseExecutableMemory() {
+  if (sExecutableMemory != nullptr) {
+    munmap(sExecutableMemory, k_executableMemorySize);
+    sExecutableMemory = nullptr;
+  }
+}
+#endif
+
 extern "C" {
   extern const void * _stack_start;
   extern const void * _stack_end;
@@ -191,12 +346,21 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
 
 void MicroPython::deinit() {
   mp_deinit();
+#if MICROPY_EMIT_NATIVE
+  releaseExecutableMemory();
+#endif
 }
 
 void MicroPython::registerScriptProvider(ScriptProvider * s) {
   sScriptProvider = s;
 }
 
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+void MicroPython::registerCompiledScriptsCache(char * buffer, size_t size) {
+  sCompiledScriptsCache.setBuffer(buffer, size);
+}
+#endif
+
 void MicroPython::collectRootsAtAddress(char * address, int byteLength) {
   /* The given address is not necessarily aligned on sizeof(void *). However,
    * any pointer stored in the range [address, address + byteLength] will be
@@ -360,6 +524,83 @@ mp_lexer_t * mp_lexer_new_from_file(const char * filename) {
   }
 }
 
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+
+/* With a compiled scripts cache, the script "name.py" is imported as
+ * "name.mpy", which mp_reader_new_file reads from the cache. Return false if
+ * path is not the name of such a compiled script. */
+static bool scriptNameOfCompiledScript(const char * path, char * scriptName, size_t scriptNameSize) {
+  constexpr const char * compiledExtension = ".mpy";
+  size_t pathLength = strlen(path);
+  size_t extensionLength = strlen(compiledExtension);
+  if (!sCompiledScriptsCache.isEnabled() || pathLength < extensionLength || strcmp(path + pathLength - extensionLength, compiledExtension) != 0 || pathLength >= scriptNameSize) {
+    return false;
+  }
+  // Remove the 'm' of ".mpy"
+  memcpy(scriptName, path, pathLength - 3);
+  strlcpy(scriptName + pathLength - 3, "py", scriptNameSize - pathLength + 3);
+  return true;
+}
+
+static uint32_t checksum(const char * text, size_t length) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t *>(text), length);
+}
+
+mp_import_stat_t mp_import_stat(const char *path) {
+  if (sScriptProvider == nullptr) {
+    return MP_IMPORT_STAT_NO_EXIST;
+  }
+  char scriptName[MICROPY_ALLOC_PATH_MAX];
+  if (scriptNameOfCompiledScript(path, scriptName, sizeof(scriptName))) {
+    return sScriptProvider->contentOfScript(scriptName, false) ? MP_IMPORT_STAT_FILE : MP_IMPORT_STAT_NO_EXIST;
+  }
+  if (!sCompiledScriptsCache.isEnabled() && sScriptProvider->contentOfScript(path, false)) {
+    return MP_IMPORT_STAT_FILE;
+  }
+  return MP_IMPORT_STAT_NO_EXIST;
+}
+
+void mp_reader_new_file(mp_reader_t * reader, const char * filename) {
+  char scriptName[MICROPY_ALLOC_PATH_MAX];
+  const char * script = nullptr;
+  if (sScriptProvider != nullptr && scriptNameOfCompiledScript(filename, scriptName, sizeof(scriptName))) {
+    script = sScriptProvider->contentOfScript(scriptName, true);
+  }
+  if (script == nullptr) {
+    mp_raise_OSError(MP_ENOENT);
+  }
+  size_t scriptLength = strlen(script);
+  size_t scriptNameLength = strlen(scriptName);
+  CompiledScriptsCache::ScriptIdentifier identifier = {
+    static_cast<uint32_t>(scriptNameLength),
+    checksum(scriptName, scriptNameLength),
+    static_cast<uint32_t>(scriptLength),
+    checksum(script, scriptLength)
+  };
+  size_t codeSize = 0;
+  const byte * code = sCompiledScriptsCache.codeOfScript(identifier, &codeSize);
+  if (code == nullptr) {
+    // Compile the script and save its code in the cache
+    mp_lexer_t * lex = mp_lexer_new_from_str_len(qstr_from_str(scriptName), script, scriptLength, 0);
+    qstr sourceName = lex->source_name;
+    mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+    mp_raw_code_t * rawCode = mp_compile_to_raw_code(&parseTree, sourceName, false);
+    vstr_t vstr;
+    vstr_init(&vstr, 64);
+    mp_print_t print = {&vstr, (mp_print_strn_t)vstr_add_strn};
+    mp_raw_code_save(rawCode, &print);
+    codeSize = vstr.len;
+    code = sCompiledScriptsCache.storeCodeOfScript(identifier, reinterpret_cast<const byte *>(vstr.buf), codeSize);
+    if (code == nullptr) {
+      // The script is too large to be cached: load it from the heap
+      code = reinterpret_cast<const byte *>(vstr.buf);
+    }
+  }
+  mp_reader_new_mem(reader, code, codeSize, 0);
+}
+
+#else
+
 mp_import_stat_t mp_import_stat(const char *path) {
   if (sScriptProvider && sScriptProvider->contentOfScript(path, false)) {
     return MP_IMPORT_STAT_FILE;
@@ -367,6 +608,8 @@ mp_import_stat_t mp_import_stat(const char *path) {
   return MP_IMPORT_STAT_NO_EXIST;
 }
 
+#endif
+
 void mp_hal_stdout_tx_strn_cooked(const char * str, size_t len) {
   assert(sCurrentExecutionEnvironment != nullptr);
   sCurrentExecutionEnvironment->printText(str, len);
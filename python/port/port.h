@@ -39,6 +39,13 @@ public:
 void init(void * heapStart, void * heapEnd);
 void deinit();
 void registerScriptProvider(ScriptProvider * s);
+#if MICROPY_PORT_COMPILED_SCRIPTS_CACHE
+/* Scripts imported from the ScriptProvider are compiled to MicroPython's .mpy
+ * format into the cache, which outlives the heap. A script which did not
+ * change since it was cached is loaded from there rather than parsed and
+ * compiled again. The buffer must be zero-filled when first registered. */
+void registerCompiledScriptsCache(char * buffer, size_t size);
+#endif
 void collectRootsAtAddress(char * address, int len);
 
 class Color {
@@ -272,6 +272,11 @@
 #define MICROPY_PERSISTENT_CODE_SAVE (0)
 #endif
 
+// Whether to support saving persistent code to a file via mp_raw_code_save_file
+#ifndef MICROPY_PERSISTENT_CODE_SAVE_FILE
+#define MICROPY_PERSISTENT_CODE_SAVE_FILE (0)
+#endif
+
 // Whether generated code can persist independently of the VM/runtime instance
 // This is enabled automatically when needed by other features
 #ifndef MICROPY_PERSISTENT_CODE
@@ -328,6 +333,12 @@
 #define MICROPY_EMIT_XTENSAWIN (0)
 #endif
 
+// Whether native code calls MICROPY_VM_HOOK_LOOP and raises pending exceptions
+// at the back-edges of loops, as the bytecode VM does
+#ifndef MICROPY_EMIT_NATIVE_LOOP_HOOK
+#define MICROPY_EMIT_NATIVE_LOOP_HOOK (0)
+#endif
+
 // Convenience definition for whether any native emitter is enabled
 #define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA || MICROPY_EMIT_XTENSAWIN)
 
@@ -149,6 +149,18 @@ STATIC void mp_native_raise(mp_obj_t o) {
     }
 }
 
+#if MICROPY_EMIT_NATIVE_LOOP_HOOK
+// called at the back-edges of loops, like the VM hook of the bytecode loop
+STATIC void mp_native_loop_hook(void) {
+    MICROPY_VM_HOOK_LOOP
+    mp_obj_t obj = MP_STATE_VM(mp_pending_exception);
+    if (obj != MP_OBJ_NULL) {
+        MP_STATE_VM(mp_pending_exception) = MP_OBJ_NULL;
+        nlr_raise(obj);
+    }
+}
+#endif
+
 // wrapper that handles iterator buffer
 STATIC mp_obj_t mp_native_getiter(mp_obj_t obj, mp_obj_iter_buf_t *iter) {
     if (iter == NULL) {
@@ -313,7 +325,12 @@ const mp_fun_table_t mp_fun_table = {
     #else
     NULL,
     #endif
-    // Additional entries for dynamic runtime, starts at index 50
+    #if MICROPY_EMIT_NATIVE_LOOP_HOOK
+    mp_native_loop_hook,
+    #else
+    NULL,
+    #endif
+    // Additional entries for dynamic runtime, starts at index 51
     memset,
     memmove,
     gc_realloc,
@@ -323,7 +340,11 @@ const mp_fun_table_t mp_fun_table = {
     mp_obj_get_type,
     mp_obj_new_str,
     mp_obj_new_bytes,
+    #if MICROPY_PY_BUILTINS_BYTEARRAY
     mp_obj_new_bytearray_by_ref,
+    #else
+    NULL,
+    #endif
     mp_obj_new_float_from_f,
     mp_obj_new_float_from_d,
     mp_obj_get_float_to_f,
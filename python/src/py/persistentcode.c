@@ -810,6 +810,8 @@ void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print) {
     save_raw_code(print, rc, &qw);
 }
 
+#if MICROPY_PERSISTENT_CODE_SAVE_FILE
+
 // here we define mp_raw_code_save_file depending on the port
 // TODO abstract this away properly
 
@@ -836,4 +838,6 @@ void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename) {
 #error mp_raw_code_save_file not implemented for this platform
 #endif
 
+#endif // MICROPY_PERSISTENT_CODE_SAVE_FILE
+
 #endif // MICROPY_PERSISTENT_CODE_SAVE
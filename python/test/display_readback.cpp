@@ -0,0 +1,5 @@
+#include "execution_environment.h"
+
+void set_display_readback(bool) {
+  // The device display can always be read back
+}
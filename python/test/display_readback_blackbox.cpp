@@ -0,0 +1,6 @@
+#include "execution_environment.h"
+#include <ion/src/blackbox/display.h>
+
+void set_display_readback(bool enabled) {
+  Ion::Display::Blackbox::setFrameBufferActive(enabled);
+}
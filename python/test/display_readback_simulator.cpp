@@ -0,0 +1,6 @@
+#include "execution_environment.h"
+#include <ion/src/simulator/shared/framebuffer.h>
+
+void set_display_readback(bool enabled) {
+  Ion::Simulator::Framebuffer::setActive(enabled);
+}
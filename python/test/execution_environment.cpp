@@ -12,6 +12,12 @@ void TestExecutionEnvironment::printText(const char * text, size_t length) {
   m_printTextBuffer[m_printTextIndex] = 0;
 }
 
+void TestExecutionEnvironment::displayViewController(ViewController * controller) {
+  if (controller != nullptr) {
+    controller->viewWillAppear();
+  }
+}
+
 // TODO: this will be obsolete when runCode will take a parameter to choose the input type
 
 void inlineToBeSingleInput(char * buffer, size_t bufferSize, const char * script) {
@@ -5,6 +5,8 @@ class TestExecutionEnvironment : public MicroPython::ExecutionEnvironment {
 public:
   TestExecutionEnvironment() : m_printTextIndex(0) {}
   void printText(const char * text, size_t length) override;
+  // Controllers are not displayed, but get ready to appear as if they were
+  void displayViewController(ViewController * controller) override;
   const char * lastPrintedText() const { return m_printTextBuffer; }
 
   static constexpr int s_pythonHeapSize = Code::App::k_pythonHeapSize;
@@ -22,3 +24,7 @@ void assert_script_execution_succeeds(const char * script, const char * outputTe
 void assert_script_execution_fails(const char * script);
 void assert_command_execution_succeeds(TestExecutionEnvironment env, const char * line, const char * outputText = nullptr);
 void assert_command_execution_fails(TestExecutionEnvironment env, const char * line);
+
+/* Keep the pixels drawn on the display readable, so that tests can check them.
+ * Headless simulators do not keep a framebuffer otherwise. */
+void set_display_readback(bool enabled);
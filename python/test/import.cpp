@@ -0,0 +1,87 @@
+#include <quiz.h>
+#include "execution_environment.h"
+#include <stdio.h>
+#include <string.h>
+
+class TestScriptProvider : public MicroPython::ScriptProvider {
+public:
+  TestScriptProvider() : m_numberOfScripts(0) {}
+  const char * contentOfScript(const char * name, bool markAsFetched) override {
+    for (int i = 0; i < m_numberOfScripts; i++) {
+      if (strcmp(name, m_names[i]) == 0) {
+        return m_contents[i];
+      }
+    }
+    return nullptr;
+  }
+  void setScript(int index, const char * name, const char * content) {
+    m_names[index] = name;
+    m_contents[index] = content;
+    m_numberOfScripts = index + 1 > m_numberOfScripts ? index + 1 : m_numberOfScripts;
+  }
+private:
+  constexpr static int k_maxNumberOfScripts = 2;
+  const char * m_names[k_maxNumberOfScripts];
+  const char * m_contents[k_maxNumberOfScripts];
+  int m_numberOfScripts;
+};
+
+static char s_compiledScriptsCache[512];
+
+static bool compiled_scripts_cache_is_empty() {
+  for (size_t i = 0; i < sizeof(s_compiledScriptsCache); i++) {
+    if (s_compiledScriptsCache[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+QUIZ_CASE(python_import_compiled_script) {
+  TestScriptProvider scriptProvider;
+  scriptProvider.setScript(0, "triple.py", "def triple(x):\n  return 3*x\nhalf = 0.5\n");
+  MicroPython::registerScriptProvider(&scriptProvider);
+  memset(s_compiledScriptsCache, 0, sizeof(s_compiledScriptsCache));
+  MicroPython::registerCompiledScriptsCache(s_compiledScriptsCache, sizeof(s_compiledScriptsCache));
+
+  // The script is compiled into the cache
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from triple import *");
+  assert_command_execution_succeeds(env, "triple(half)", "1.5\n");
+  deinit_environment();
+  quiz_assert(!compiled_scripts_cache_is_empty());
+
+  // The cached code outlives the heap
+  env = init_environement();
+  assert_command_execution_succeeds(env, "import triple");
+  assert_command_execution_succeeds(env, "triple.triple(7)", "21\n");
+  deinit_environment();
+
+  // Edited scripts are compiled again
+  scriptProvider.setScript(0, "triple.py", "def triple(x):\n  return x+x+x\nhalf = 1/2\n");
+  env = init_environement();
+  assert_command_execution_succeeds(env, "from triple import *");
+  assert_command_execution_succeeds(env, "triple('a')", "'aaa'\n");
+  deinit_environment();
+
+  // Scripts too large for the cache and erroneous scripts are still imported
+  constexpr int largeScriptSize = 1000;
+  char largeScript[largeScriptSize];
+  char * c = largeScript;
+  for (int i = 0; i < 100; i++) {
+    c += snprintf(c, largeScript + largeScriptSize - c, "v%d = %d\n", i, i);
+  }
+  scriptProvider.setScript(1, "large.py", largeScript);
+  env = init_environement();
+  assert_command_execution_succeeds(env, "from large import *");
+  assert_command_execution_succeeds(env, "v99+v1", "100\n");
+  deinit_environment();
+  scriptProvider.setScript(1, "large.py", "def broken(:\n");
+  env = init_environement();
+  assert_command_execution_fails(env, "import large");
+  assert_command_execution_fails(env, "import missing");
+  deinit_environment();
+
+  MicroPython::registerCompiledScriptsCache(nullptr, 0);
+  MicroPython::registerScriptProvider(nullptr);
+}
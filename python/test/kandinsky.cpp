@@ -26,3 +26,45 @@ QUIZ_CASE(python_kandinsky_basics) {
   assert_command_execution_succeeds(env, "draw_string('hello',0,0)");
   deinit_environment();
 }
+
+QUIZ_CASE(python_kandinsky_blit) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  // RGB565 sprites
+  assert_command_execution_succeeds(env, "sprite = grab(9,10,3,2)");
+  assert_command_execution_succeeds(env, "len(sprite)", "12\n");
+  assert_command_execution_succeeds(env, "len(grab(-5,-5,20,20))", "800\n");
+  assert_command_execution_succeeds(env, "blit(100,100,3,2,sprite)");
+  assert_command_execution_succeeds(env, "blit(100,100,3,2,bytes(sprite))");
+  assert_command_execution_succeeds(env, "blit(318,238,3,2,sprite)");
+  assert_command_execution_succeeds(env, "blit(10,10,64,64,bytearray(64*64*2))");
+  assert_command_execution_fails(env, "blit(0,0,3,3,sprite)");
+  assert_command_execution_fails(env, "blit(0,0,-3,2,sprite)");
+  assert_command_execution_fails(env, "grab(0,0,-1,2)");
+  assert_command_execution_fails(env, "grab(0,0,40000,1)");
+  // Palette sprites
+  assert_command_execution_succeeds(env, "blit(0,0,3,2,bytes([0,1,0,1,1,0]),[(0,0,0),(0,0,255)])");
+  assert_command_execution_succeeds(env, "blit(-1,-1,3,2,bytes([0x10,0x20,0x02,0x10]),['red','white','green'],4)");
+  assert_command_execution_succeeds(env, "blit(300,0,100,200,bytearray(100*200),[(0,0,0)])");
+  // Rows wider than a band are split, here at x = 24
+  set_display_readback(true);
+  assert_command_execution_succeeds(env, "blit(-1000,5,1100,2,bytearray(1100*2),[(255,0,0)])");
+  assert_command_execution_succeeds(env, "grab(20,6,8,1) == bytes([0,248]*8)", "True\n");
+  set_display_readback(false);
+  assert_command_execution_fails(env, "blit(0,0,40000,1,bytearray(40000),[(0,0,0)])");
+  assert_command_execution_fails(env, "blit(0,0,2,1,bytes([0,2]),[(0,0,0),(0,0,255)])");
+  assert_command_execution_fails(env, "blit(0,0,2,1,bytes([0,1]),[(0,0,0)],2)");
+  assert_command_execution_fails(env, "blit(0,0,3,1,bytes([0]),[(0,0,0)],4)");
+  assert_command_execution_succeeds(env, "blit(0,0,2,1,bytes([0]),[(0,0,0)]*16,4)");
+  assert_command_execution_fails(env, "blit(0,0,2,1,bytes([0]),[(0,0,0)]*17,4)");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_kandinsky_fill_rects) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "fill_rects([(0,0,10,10),(20,20,-5,-5)],color(0,0,255))");
+  assert_command_execution_succeeds(env, "fill_rects(((0,0,1,1),),'red')");
+  assert_command_execution_fails(env, "fill_rects([(0,0,10)],color(0,0,255))");
+  deinit_environment();
+}
@@ -102,6 +102,21 @@ QUIZ_CASE(python_matplotlib_pyplot_plot) {
   deinit_environment();
 }
 
+QUIZ_CASE(python_matplotlib_pyplot_plot_large) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "from math import sin");
+  // The points of the curve take much less room than the list of their values
+  assert_command_execution_succeeds(env, "y = [sin(i/100) for i in range(1000)]");
+  assert_command_execution_succeeds(env, "plot(y)");
+  assert_command_execution_succeeds(env, "plot(y,y)");
+  // The automatic range is computed as the points are added
+  assert_command_execution_succeeds(env, "show()");
+  assert_command_execution_succeeds(env, "a = axis()");
+  assert_command_execution_succeeds(env, "a[0] < 0 and a[1] > 999 and a[2] < -1 and 1 < a[3] < 1.5", "True\n");
+  deinit_environment();
+}
+
 QUIZ_CASE(python_matplotlib_pyplot_scatter) {
   TestExecutionEnvironment env = init_environement();
   assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
@@ -0,0 +1,61 @@
+#include <quiz.h>
+#include "execution_environment.h"
+#include <string.h>
+
+QUIZ_CASE(python_native_code) {
+  // Native and viper functions compute what bytecode functions do
+  assert_script_execution_succeeds(R"(@micropython.native
+def collatz(n):
+  s = 0
+  while n != 1:
+    n = n//2 if n%2 == 0 else 3*n+1
+    s += 1
+  return s
+@micropython.viper
+def sum_below(n:int) -> int:
+  s = 0
+  for i in range(n):
+    s += i
+  return s
+print(collatz(27), sum_below(100)))", "111 4950\n");
+}
+
+class InterruptingEnvironment : public TestExecutionEnvironment {
+public:
+  // Interrupt the execution as soon as the VM hook runs
+  void refreshPrintOutput() override { interrupt(); }
+};
+
+QUIZ_CASE(python_native_code_interruption) {
+  // Loops of native and viper functions run the VM hook
+  MicroPython::init(TestExecutionEnvironment::s_pythonHeap, TestExecutionEnvironment::s_pythonHeap + TestExecutionEnvironment::s_pythonHeapSize);
+  InterruptingEnvironment env;
+  quiz_assert(!env.runCode("@micropython.native\ndef f():\n  while True:\n    pass\nf()"));
+  quiz_assert(!env.runCode("@micropython.viper\ndef g():\n  i = 0\n  while i >= 0:\n    i += 1\ng()"));
+  MicroPython::deinit();
+}
+
+class NativeScriptProvider : public MicroPython::ScriptProvider {
+public:
+  const char * contentOfScript(const char * name, bool markAsFetched) override {
+    return strcmp(name, "native.py") == 0 ? "@micropython.native\ndef f(x):\n  return 2*x+1\n@micropython.viper\ndef g(x:int) -> int:\n  return 3*x\n" : nullptr;
+  }
+};
+
+static char s_compiledScriptsCache[512];
+
+QUIZ_CASE(python_native_code_compiled_script) {
+  // Native code is saved in and loaded from the compiled scripts cache
+  NativeScriptProvider scriptProvider;
+  MicroPython::registerScriptProvider(&scriptProvider);
+  memset(s_compiledScriptsCache, 0, sizeof(s_compiledScriptsCache));
+  MicroPython::registerCompiledScriptsCache(s_compiledScriptsCache, sizeof(s_compiledScriptsCache));
+  for (int i = 0; i < 2; i++) {
+    TestExecutionEnvironment env = init_environement();
+    assert_command_execution_succeeds(env, "from native import *");
+    assert_command_execution_succeeds(env, "f(3)+g(2)", "13\n");
+    deinit_environment();
+  }
+  MicroPython::registerCompiledScriptsCache(nullptr, 0);
+  MicroPython::registerScriptProvider(nullptr);
+}
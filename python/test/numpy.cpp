@@ -0,0 +1,144 @@
+#include <quiz.h>
+#include "execution_environment.h"
+
+QUIZ_CASE(python_numpy_array) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "np.array([1,2.5,-3])", "array([1.0, 2.5, -3.0])\n");
+  assert_command_execution_succeeds(env, "np.array(range(3))", "array([0.0, 1.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "np.zeros(2)", "array([0.0, 0.0])\n");
+  assert_command_execution_succeeds(env, "np.ones(0)", "array([])\n");
+  assert_command_execution_fails(env, "np.zeros(-1)");
+  assert_command_execution_fails(env, "np.zeros(2**62)");
+  assert_command_execution_fails(env, "np.array(['a'])");
+  assert_command_execution_succeeds(env, "np.linspace(0,1,5)", "array([0.0, 0.25, 0.5, 0.75, 1.0])\n");
+  assert_command_execution_succeeds(env, "len(np.linspace(0,1))", "50\n");
+  assert_command_execution_succeeds(env, "np.arange(3)", "array([0.0, 1.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "np.arange(1,2,0.25)", "array([1.0, 1.25, 1.5, 1.75])\n");
+  assert_command_execution_succeeds(env, "np.arange(3,1,-1)", "array([3.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "np.arange(3,1)", "array([])\n");
+  assert_command_execution_fails(env, "np.arange(0,1,0)");
+  assert_command_execution_fails(env, "np.arange(0,float('inf'))");
+  assert_command_execution_fails(env, "np.arange(float('nan'))");
+  assert_command_execution_fails(env, "np.arange(0,1e300,1e-300)");
+  assert_command_execution_fails(env, "np.arange(1e30)");
+  assert_command_execution_succeeds(env, "a = np.array([1,2,3])");
+  assert_command_execution_succeeds(env, "[x for x in a]", "[1.0, 2.0, 3.0]\n");
+  assert_command_execution_succeeds(env, "a.tolist()", "[1.0, 2.0, 3.0]\n");
+  assert_command_execution_succeeds(env, "a[-1]", "3.0\n");
+  assert_command_execution_fails(env, "a[3]");
+  assert_command_execution_succeeds(env, "a[0] = 5");
+  assert_command_execution_succeeds(env, "a", "array([5.0, 2.0, 3.0])\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_arithmetic) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "a = np.array([1,2,4])");
+  assert_command_execution_succeeds(env, "a+a", "array([2.0, 4.0, 8.0])\n");
+  assert_command_execution_succeeds(env, "a-[1,1,1]", "array([0.0, 1.0, 3.0])\n");
+  assert_command_execution_succeeds(env, "2*a", "array([2.0, 4.0, 8.0])\n");
+  assert_command_execution_succeeds(env, "1-a", "array([0.0, -1.0, -3.0])\n");
+  assert_command_execution_succeeds(env, "a/2", "array([0.5, 1.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "2/a", "array([2.0, 1.0, 0.5])\n");
+  assert_command_execution_succeeds(env, "a**2", "array([1.0, 4.0, 16.0])\n");
+  assert_command_execution_succeeds(env, "2**a", "array([2.0, 4.0, 16.0])\n");
+  assert_command_execution_succeeds(env, "-a", "array([-1.0, -2.0, -4.0])\n");
+  assert_command_execution_succeeds(env, "abs(-a)", "array([1.0, 2.0, 4.0])\n");
+  assert_command_execution_fails(env, "a+np.zeros(2)");
+  assert_command_execution_fails(env, "a+'a'");
+  assert_command_execution_fails(env, "a//2");
+  assert_command_execution_succeeds(env, "b = a");
+  assert_command_execution_succeeds(env, "a *= 3");
+  assert_command_execution_succeeds(env, "b", "array([3.0, 6.0, 12.0])\n");
+  assert_command_execution_succeeds(env, "a += a[::-1]");
+  assert_command_execution_succeeds(env, "a", "array([15.0, 12.0, 15.0])\n");
+  assert_command_execution_succeeds(env, "np.sqrt(np.array([1,4,9]))", "array([1.0, 2.0, 3.0])\n");
+  assert_command_execution_succeeds(env, "np.exp(np.zeros(2))", "array([1.0, 1.0])\n");
+  assert_command_execution_succeeds(env, "np.log([1])", "array([0.0])\n");
+  assert_command_execution_succeeds(env, "np.cos(0)", "1.0\n");
+  assert_command_execution_succeeds(env, "np.sin(np.array([0]))+np.tan([0])", "array([0.0])\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_views) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "a = np.arange(6)");
+  assert_command_execution_succeeds(env, "a[1:3]", "array([1.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "a[::2]", "array([0.0, 2.0, 4.0])\n");
+  assert_command_execution_succeeds(env, "a[::-2]", "array([5.0, 3.0, 1.0])\n");
+  assert_command_execution_succeeds(env, "a[4:1:-1]", "array([4.0, 3.0, 2.0])\n");
+  assert_command_execution_succeeds(env, "a[1:1]", "array([])\n");
+  assert_command_execution_succeeds(env, "a[::2][1:]", "array([2.0, 4.0])\n");
+  // Slices share the items of the array
+  assert_command_execution_succeeds(env, "v = a[1::2]");
+  assert_command_execution_succeeds(env, "v[0] = 10");
+  assert_command_execution_succeeds(env, "v *= 2");
+  assert_command_execution_succeeds(env, "a", "array([0.0, 20.0, 2.0, 6.0, 4.0, 10.0])\n");
+  assert_command_execution_succeeds(env, "a[:2] = 7");
+  assert_command_execution_succeeds(env, "a[4:] = [8,9]");
+  assert_command_execution_succeeds(env, "a", "array([7.0, 7.0, 2.0, 6.0, 8.0, 9.0])\n");
+  assert_command_execution_fails(env, "a[4:] = [8]");
+  // Copies do not
+  assert_command_execution_succeeds(env, "c = a[:2].copy()");
+  assert_command_execution_succeeds(env, "c[0] = 0");
+  assert_command_execution_succeeds(env, "d = np.array(a)");
+  assert_command_execution_succeeds(env, "d[1] = 0");
+  assert_command_execution_succeeds(env, "a[:2]", "array([7.0, 7.0])\n");
+  // Views outlive the variable of their array
+  assert_command_execution_succeeds(env, "w = np.arange(1000)[500:]");
+  assert_command_execution_succeeds(env, "del a, v");
+  // Allocate enough to collect the garbage several times
+  assert_command_execution_succeeds(env, "for i in range(200): t = np.ones(1000)");
+  assert_command_execution_succeeds(env, "w[499]", "999.0\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_reductions) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "a = np.array([2,4,4,4,5,5,7,9])");
+  assert_command_execution_succeeds(env, "np.sum(a)", "40.0\n");
+  assert_command_execution_succeeds(env, "a.mean()", "5.0\n");
+  assert_command_execution_succeeds(env, "np.std(a)", "2.0\n");
+  assert_command_execution_succeeds(env, "np.min(a[1:])", "4.0\n");
+  assert_command_execution_succeeds(env, "a.max()", "9.0\n");
+  assert_command_execution_succeeds(env, "np.mean([1,2])", "1.5\n");
+  assert_command_execution_fails(env, "np.max(np.zeros(0))");
+  assert_command_execution_succeeds(env, "b = np.array([3,1,2,0])");
+  assert_command_execution_succeeds(env, "np.sort(b)", "array([0.0, 1.0, 2.0, 3.0])\n");
+  assert_command_execution_succeeds(env, "b", "array([3.0, 1.0, 2.0, 0.0])\n");
+  assert_command_execution_succeeds(env, "b[::2].sort()");
+  assert_command_execution_succeeds(env, "b", "array([2.0, 1.0, 3.0, 0.0])\n");
+  assert_command_execution_succeeds(env, "b.sort()");
+  assert_command_execution_succeeds(env, "b", "array([0.0, 1.0, 2.0, 3.0])\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_matplotlib) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "x = np.linspace(0,6,100)");
+  assert_command_execution_succeeds(env, "plot(x,np.sin(x))");
+  assert_command_execution_succeeds(env, "plot(np.cos(x))");
+  assert_command_execution_succeeds(env, "scatter(x[::10],x[::10]**2)");
+  assert_command_execution_succeeds(env, "hist(np.sin(x))");
+  assert_command_execution_fails(env, "scatter(x,x[1:])");
+  assert_command_execution_fails(env, "plot(x,x[1:])");
+  deinit_environment();
+
+  // Strided arrays are read in place
+  env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "from matplotlib.pyplot import *");
+  assert_command_execution_succeeds(env, "x = np.linspace(10,16,100)");
+  assert_command_execution_succeeds(env, "y = np.sin(x-10)-5");
+  assert_command_execution_succeeds(env, "plot(x[::-2],y[::2])");
+  assert_command_execution_succeeds(env, "show()");
+  assert_command_execution_succeeds(env, "a = axis()");
+  assert_command_execution_succeeds(env, "9 < a[0] < 10 and 16 < a[1] < 17 and -6.5 < a[2] < -6 and -4 < a[3] < -3.5", "True\n");
+  deinit_environment();
+}
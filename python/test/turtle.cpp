@@ -36,3 +36,65 @@ QUIZ_CASE(python_turtle_circle) {
   //assert_command_execution_succeeds(env, "position()", "(0.0, 0.0)\n");
   deinit_environment();
 }
+
+QUIZ_CASE(python_turtle_tracer) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from turtle import *");
+  assert_command_execution_succeeds(env, "tracer()", "1\n");
+  assert_command_execution_succeeds(env, "tracer(0)");
+  assert_command_execution_succeeds(env, "tracer()", "0\n");
+  assert_command_execution_succeeds(env, "forward(50)");
+  assert_command_execution_succeeds(env, "left(90)");
+  assert_command_execution_succeeds(env, "pensize(3)");
+  assert_command_execution_succeeds(env, "goto(50,50)");
+  assert_command_execution_succeeds(env, "position()", "(50.0, 50.0)\n");
+  assert_command_execution_succeeds(env, "heading()", "90.0\n");
+  assert_command_execution_succeeds(env, "circle(20)");
+  assert_command_execution_succeeds(env, "update()");
+  assert_command_execution_succeeds(env, "goto(1e30,0)");
+  assert_command_execution_succeeds(env, "goto(0,0)");
+  set_display_readback(true);
+  assert_command_execution_succeeds(env, "from kandinsky import grab");
+  assert_command_execution_succeeds(env, "hideturtle()");
+  assert_command_execution_succeeds(env, "color('red')");
+  assert_command_execution_succeeds(env, "pensize(5)");
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(-100,50)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "goto(-50,50)");
+  assert_command_execution_succeeds(env, "grab(60,59,50,1) == bytes([0,248]*50)", "True\n");
+  assert_command_execution_succeeds(env, "grab(60,63,50,1) == bytes([0,248]*50)", "True\n");
+  // The ends are round, not square
+  assert_command_execution_succeeds(env, "grab(112,63,1,1) == bytes([0,248])", "False\n");
+  assert_command_execution_succeeds(env, "grab(110,61,1,1) == bytes([0,248])", "True\n");
+  // Diagonal lines are as thick as horizontal ones, perpendicularly to them
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(-100,-50)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "goto(-50,0)");
+  assert_command_execution_succeeds(env, "grab(85,133,1,7) == bytes([0,248]*7)", "True\n");
+  assert_command_execution_succeeds(env, "grab(85,132,1,1) == bytes([0,248])", "False\n");
+  assert_command_execution_succeeds(env, "grab(85,140,1,1) == bytes([0,248])", "False\n");
+  // Circles are drawn as chords of a few degrees
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(50,-100)");
+  assert_command_execution_succeeds(env, "setheading(0)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "circle(40)");
+  assert_command_execution_succeeds(env, "heading()", "0.0\n");
+  assert_command_execution_succeeds(env, "grab(210,131,1,1) == bytes([0,248])", "True\n");
+  assert_command_execution_succeeds(env, "grab(170,171,1,1) == bytes([0,248])", "True\n");
+  assert_command_execution_succeeds(env, "grab(250,171,1,1) == bytes([0,248])", "True\n");
+  assert_command_execution_succeeds(env, "grab(210,171,1,1) == bytes([0,248])", "False\n");
+  // Moves beyond the bounds of the turtle draw their visible part
+  assert_command_execution_succeeds(env, "pensize(1)");
+  assert_command_execution_succeeds(env, "penup()");
+  assert_command_execution_succeeds(env, "goto(100,-80)");
+  assert_command_execution_succeeds(env, "pendown()");
+  assert_command_execution_succeeds(env, "goto(100,1e30)");
+  assert_command_execution_succeeds(env, "grab(260,0,1,190) == bytes([0,248]*190)", "True\n");
+  set_display_readback(false);
+  assert_command_execution_succeeds(env, "tracer(1, 0)");
+  assert_command_execution_succeeds(env, "tracer()", "1\n");
+  deinit_environment();
+}
@@ -0,0 +1,50 @@
+#include <quiz.h>
+#include <python/port/helpers.h>
+
+/* Run the countdown of the VM hook on a fake clock, over loops whose
+ * iterations take the given durations in microseconds. Return the longest
+ * delay between two readings of the clock, in milliseconds, and count them. */
+static uint64_t max_delay_between_clock_readings(const uint64_t * iterationDurations, const int * numbersOfIterations, int numberOfLoops, int * numberOfReadings) {
+  uint64_t time = 0;
+  uint64_t lastReadingTime = 0;
+  uint64_t maxDelay = 0;
+  int32_t numberOfIterationsBetweenReadings = 1;
+  int32_t countdown = 1;
+  *numberOfReadings = 0;
+  for (int i = 0; i < numberOfLoops; i++) {
+    for (int j = 0; j < numbersOfIterations[i]; j++) {
+      time += iterationDurations[i];
+      if (--countdown <= 0) {
+        // The clock has a millisecond resolution
+        uint64_t elapsed = time / 1000 - lastReadingTime / 1000;
+        maxDelay = elapsed > maxDelay ? elapsed : maxDelay;
+        numberOfIterationsBetweenReadings = micropython_port_vm_hook_next_countdown(numberOfIterationsBetweenReadings, elapsed);
+        countdown = numberOfIterationsBetweenReadings;
+        lastReadingTime = time;
+        (*numberOfReadings)++;
+      }
+    }
+  }
+  return maxDelay;
+}
+
+QUIZ_CASE(python_vm_hook_countdown) {
+  int numberOfReadings;
+  // Tight loops read the clock at most once every 16 iterations
+  uint64_t tightDuration[] = {1};
+  int tightIterations[] = {1000000};
+  quiz_assert(max_delay_between_clock_readings(tightDuration, tightIterations, 1, &numberOfReadings) <= 1);
+  quiz_assert(numberOfReadings < 1000000 / 16 + 10);
+
+  // Slow iterations read the clock at each iteration
+  uint64_t slowDuration[] = {20000};
+  int slowIterations[] = {100};
+  quiz_assert(max_delay_between_clock_readings(slowDuration, slowIterations, 1, &numberOfReadings) <= 20);
+  quiz_assert(numberOfReadings == 100);
+
+  /* A loop that slows down after a tight one is noticed within 16 iterations,
+   * then the clock is read at each iteration again. */
+  uint64_t mixedDurations[] = {1, 20000, 1};
+  int mixedIterations[] = {1000000, 100, 1000000};
+  quiz_assert(max_delay_between_clock_readings(mixedDurations, mixedIterations, 3, &numberOfReadings) <= 16 * 20);
+}